@@ -107,9 +107,10 @@
  *
  * 250000 works in most cases, but you might try a lower speed if
  * you commonly experience drop-outs during host printing.
- * You may try up to 1000000 to speed up SD file transfer.
+ * You may try up to 1000000 to speed up SD file transfer,
+ * or up to 2000000 with SERIAL_DMA.
  *
- * :[2400, 9600, 19200, 38400, 57600, 115200, 250000, 500000, 1000000]
+ * :[2400, 9600, 19200, 38400, 57600, 115200, 250000, 500000, 1000000, 1500000, 2000000]
  */
 #define BAUDRATE 115200
 //#define BAUD_RATE_GCODE     // Enable G-code M575 to set the baud rate
@@ -528,11 +529,54 @@
 
 #define ADS1115_BED_READING 1
 #define PCF8574_BED_CONTROL 1
+
+/**
+ * Queue I2C transfers to the bed ADC and expander (and an I2C EEPROM) so no caller
+ * waits on the bus. Transfers are interrupt driven on STM32. Required by
+ * ADS1115_BED_READING and PCF8574_BED_CONTROL. M262 reports bus statistics.
+ */
+#define I2C_ASYNC_QUEUE
+#if ENABLED(I2C_ASYNC_QUEUE)
+  #define I2C_ASYNC_QUEUE_SIZE   8  // Jobs waiting for the bus
+  #define I2C_ASYNC_TIMEOUT_MS  10  // A transfer taking longer resets the bus
+  #define I2C_ASYNC_RETRIES      2  // Retries after a bus error or timeout
+#endif
+
 #define ADS1115_ADDRESS   0x48
 #define PCF8574_ADDRESS   0x20
-#define PCF8574_WRITE_INTERVAL_MS 1000  // 1s
-#define ADS1115_WRITE_INTERVAL_MS 1000  // 1s
-#define SERIAL_MULTI_BEDS 1
+#define PCF8574_PWM_WINDOW_MS     4000  // Bed zone PWM window (1000-30000). Zones are phase-staggered within it.
+#define ADS1115_WRITE_INTERVAL_MS 1000  // 1s between full sweeps of the bed channels
+#define ADS1115_STALE_MS          5000  // A bed zone with no reading for this long is switched off
+#define ADS1115_DATA_RATE          128  // (SPS) 8, 16, 32, 64, 128, 250, 475 or 860. Lower rates reject more noise. (M308 R)
+#define ADS1115_SAMPLES              5  // Conversions per bed reading, combined by median (1-7) (M308 S)
+#define ADS1115_IIR_SHIFT            2  // Smoothing across readings. New reading weight is 1/2^N (0-6, 0=off) (M308 F)
+//#define ADS1115_RDY_PIN         -1    // ADS1115 ALERT/RDY pin, polled instead of the I2C ready flag
+
+/**
+ * Bed zone telemetry. M155 B<hz> streams every zone's temperature, target and power
+ * as one compact line per report, or as CRC-checked binary frames on a second
+ * serial port with M155 F1 P<port>.
+ * See feature/bed_telemetry.h for the formats.
+ */
+#define BED_TELEMETRY
+#if ENABLED(BED_TELEMETRY)
+  #define BED_TELEMETRY_MAX_HZ  50  // Highest report rate
+  #define BED_TELEMETRY_BUDGET  25  // (%) Most of the serial bandwidth reports may use
+  //#define BED_TELEMETRY_BINARY    // Allow binary frames on a second serial port (M155 F1 P<port>). Requires SERIAL_PORT_2.
+#endif
+
+/**
+ * Heat only the bed zones under the print footprint.
+ * The footprint comes from a pre-scan of the file selected with M23, or from the host
+ * with M196 (one call per object with A to accumulate). M140/M190 without B then heat
+ * and wait only on the zones it touches. Zones form a grid numbered from X/Y min, row by row.
+ */
+//#define BED_ZONE_FOOTPRINT
+#if ENABLED(BED_ZONE_FOOTPRINT)
+  #define BED_ZONE_GRID_X       2   // Zone columns
+  #define BED_ZONE_GRID_Y       2   // Zone rows
+  #define BED_ZONE_MARGIN      10   // (mm) Extra border around the footprint
+#endif
 
 #define TEMP_SENSOR_PROBE 0
 #define TEMP_SENSOR_CHAMBER 0
@@ -704,7 +748,7 @@
  * heater. If your configuration is significantly different than this and you don't understand
  * the issues involved, don't use bed PID until someone else verifies that your hardware works.
  */
-//#define PIDTEMPBED //NAO HABILITÁVEL PARA MULTI-BEDS!
+//#define PIDTEMPBED // With multiple beds each zone gets its own PID (M304 Bn / M303 E-1 Bn)
 
 //#define BED_LIMIT_SWITCHING
 
@@ -726,7 +770,23 @@
   #define DEFAULT_bedKi .023
   #define DEFAULT_bedKd 305.4
 
+  // Per-zone defaults for a multi-zone bed. Missing zones use the last value.
+  //#define DEFAULT_bedKp_LIST {  10.00,  10.00,  10.00,  10.00 }
+  //#define DEFAULT_bedKi_LIST {   .023,   .023,   .023,   .023 }
+  //#define DEFAULT_bedKd_LIST {  305.4,  305.4,  305.4,  305.4 }
+
   // FIND YOUR OWN: "M303 E-1 C8 S90" to run autotune on the bed at 90 degreesC for 8 cycles.
+  // For a multi-zone bed add B<zone>, e.g. "M303 E-1 B2 C8 S90 U1", and repeat for each zone.
+
+  /**
+   * Multi-zone bed thermal coupling compensation.
+   * Zones heat each other through the plate. "M303 E-1 B<zone> U1" also measures how
+   * much each other zone warms up, and the resulting matrix (M307) is used to
+   * decouple the zone controllers so all zones settle together without overshoot.
+   * The gains are read when autotune ends, before the plate settles, so tune each
+   * zone from a cold plate with the other zones off.
+   */
+  #define BED_ZONE_COUPLING
 #endif // PIDTEMPBED
 
 //===========================================================================
@@ -1189,6 +1249,14 @@
  * See https://github.com/synthetos/TinyG/wiki/Jerk-Controlled-Motion-Explained
  */
 //#define S_CURVE_ACCELERATION
+#if ENABLED(S_CURVE_ACCELERATION)
+  /**
+   * Limit the peak jerk of each speed change. Small changes that would jerk
+   * harder are stretched in time, and the planner looks ahead for it, so the
+   * acceleration can be raised without exciting frame resonances.
+   */
+  //#define S_CURVE_MAX_JERK 500000   // (mm/s³)
+#endif
 
 //===========================================================================
 //============================= Z Probe Options =============================
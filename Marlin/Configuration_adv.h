@@ -1056,6 +1056,18 @@
   #define SLOWDOWN_DIVISOR 2
 #endif
 
+/**
+ * Adaptive Kinematic Segments
+ * DELTA, SCARA and POLARGRAPH split moves into segments that are straight for
+ * the joints. Instead of always using the segments per second (M665 S), use just
+ * enough segments to keep the nozzle within the tolerance of the true line. Moves
+ * where the kinematics are nearly linear get far fewer segments.
+ */
+//#define KINEMATIC_ADAPTIVE_SEGMENTS
+#if ENABLED(KINEMATIC_ADAPTIVE_SEGMENTS)
+  #define KINEMATIC_SEGMENT_TOLERANCE 0.01 // (mm) Farthest a segment may stray from the line
+#endif
+
 /**
  * XY Frequency limit
  * Reduce resonance by limiting the frequency of small zigzag infill moves.
@@ -1617,6 +1629,15 @@
   #if ENABLED(BINARY_FILE_TRANSFER)
     // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
     //#define CUSTOM_FIRMWARE_UPLOAD
+
+    /**
+     * Binary Motion Commands
+     * Carry pre-tokenized G-code in binary stream packets, with the parameters
+     * as decimal fixed-point numbers. Motion and common M-codes go to the command
+     * queue without any text parsing. Other commands are carried as text.
+     * See buildroot/share/scripts/MarlinBinaryProtocol.py for the host encoder.
+     */
+    //#define BINARY_MOTION_COMMANDS
   #endif
 
   /**
@@ -1987,6 +2008,85 @@
   #endif
 #endif
 
+// @section motion
+
+/**
+ * Input Shaping
+ *
+ * Cancel the ringing of the X and Y axes at a resonant frequency. Each step is
+ * played as a short train of impulses whose vibrations cancel out, so higher
+ * accelerations print without ghosting. Measure the ringing frequency on a
+ * test print and set it with M593, or here. M593 also sets the damping ratio
+ * and the shaper type, and all are stored with M500.
+ *
+ * Shaper types, from the shortest delay to the most robust to frequency error:
+ *   SHAPER_ZV  : 2 impulses over 1/2 period
+ *   SHAPER_MZV : 3 impulses over 3/4 period
+ *   SHAPER_ZVD : 3 impulses over 1 period
+ *   SHAPER_EI  : 3 impulses over 1 period, 5% vibration tolerance
+ *
+ * Not for DIRECT_STEPPING or non-Cartesian kinematics.
+ */
+//#define INPUT_SHAPING_X
+//#define INPUT_SHAPING_Y
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #if ENABLED(INPUT_SHAPING_X)
+    #define SHAPING_FREQ_X  40          // (Hz) The default dominant resonant frequency on the X axis.
+    #define SHAPING_ZETA_X  0.15f       // Damping ratio of the X axis (range: 0.0 = no damping to 0.99).
+    #define SHAPING_TYPE_X  SHAPER_ZV   // SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV or SHAPER_EI
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    #define SHAPING_FREQ_Y  40          // (Hz) The default dominant resonant frequency on the Y axis.
+    #define SHAPING_ZETA_Y  0.15f       // Damping ratio of the Y axis (range: 0.0 = no damping to 0.99).
+    #define SHAPING_TYPE_Y  SHAPER_ZV   // SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV or SHAPER_EI
+  #endif
+  //#define SHAPING_MIN_FREQ  20        // (Hz) Lowest frequency M593 accepts. Default: The lowest default frequency.
+                                        // Lower values hold more steps in the shaping buffer.
+  //#define SHAPING_BUFFER_SIZE 1200    // Steps held for the echoes. Default: Enough for both axes at full speed.
+#endif
+
+/**
+ * Fixed-Time Motion
+ *
+ * An alternative to the Bresenham stepper ISR. The main loop turns the planner
+ * blocks into step counts for each axis over fixed time frames, and a fixed-rate
+ * stepper ISR only spreads those steps evenly over each frame. No speed math is
+ * left in the ISR, so its cost doesn't grow with the step rate.
+ * Turn it on or off with M493 S1 / M493 S0. The mode is stored with M500.
+ *
+ * The highest step rate of each axis is FTM_FRAME_RATE * FTM_STEPS_PER_FRAME.
+ * Input Shaping applies to the standard stepper ISR only.
+ *
+ * With FTM_CURVE_BLOCKS an arc or Bézier costs one block instead of dozens of
+ * chords, at the speed its tightest bend allows. Curves are still cut into
+ * chords with bed leveling on, or if they pass the soft endstops.
+ *
+ * Needs a 32-bit board. Not for CoreXY/XZ/YZ, Markforged, DIRECT_STEPPING,
+ * MIXING_EXTRUDER or a spindle / laser. LIN_ADVANCE needs SMOOTH_LIN_ADVANCE.
+ */
+//#define FT_MOTION
+#if ENABLED(FT_MOTION)
+  #define FTM_DEFAULT_ACTIVE  false     // Start in Fixed-Time Motion mode
+  #define FTM_FRAME_RATE       1000     // (Hz) Trajectory frames per second
+  #define FTM_STEPS_PER_FRAME    40     // Stepper ISR calls per frame, and the most steps per frame on each axis (max 255)
+  #define FTM_BUFFER_FRAMES      50     // Frames computed ahead of the stepper (max 255). 50 frames at 1kHz = 50ms.
+  #define FTM_CURVE_BLOCKS              // Queue each G2/G3 arc and G5 Bézier as one planner block, traced by the frames
+
+  /**
+   * Play the frames by timer-paced DMA writes of STEP/DIR patterns to the GPIO
+   * port instead of calling the stepper ISR for every step slot. The stepper ISR
+   * only runs twice per frame to fill the pattern buffer. STM32F4 only.
+   * All STEP and DIR pins must be on one GPIO port, or the ISR is used.
+   * The ISR must never be held off for half a frame, or the DMA plays a frame twice.
+   * Not for multiple extruders, DUAL_X_CARRIAGE, multiple endstops per axis,
+   * Z_STEPPER_AUTO_ALIGN or BABYSTEPPING.
+   */
+  //#define FTM_STEP_DMA
+  #if ENABLED(FTM_STEP_DMA)
+    #define FTM_DMA_TIMER 8             // Advanced timer to pace the DMA. 1 (DMA2 Stream 5) or 8 (DMA2 Stream 1). Reserved for this.
+  #endif
+#endif
+
 // @section extruder
 
 /**
@@ -2002,6 +2102,10 @@
  * If this algorithm produces a higher speed offset than the extruder can handle (compared to E jerk)
  * print acceleration will be reduced during the affected moves to keep within the limit.
  *
+ * With SMOOTH_LIN_ADVANCE and Fixed-Time Motion active, the advance is added to the E position
+ * of each frame instead, from the E speed averaged over ADVANCE_SMOOTH_TIME. There are no extra
+ * E steps at their own ISR rate and no limit on acceleration. All axes run half the time late.
+ *
  * See https://marlinfw.org/docs/features/lin_advance.html for full instructions.
  */
 //#define LIN_ADVANCE
@@ -2011,6 +2115,10 @@
   //#define LA_DEBUG            // If enabled, this will generate debug information output over USB.
   //#define EXPERIMENTAL_SCURVE // Enable this option to permit S-Curve Acceleration
   //#define ALLOW_LOW_EJERK     // Allow a DEFAULT_EJERK value of <10. Recommended for direct drive hotends.
+  //#define SMOOTH_LIN_ADVANCE  // Advance from the average E speed under FT_MOTION
+  #if ENABLED(SMOOTH_LIN_ADVANCE)
+    #define ADVANCE_SMOOTH_TIME 0.04  // (s) Time to average the E speed over (max 0.1). Set with M900 U.
+  #endif
 #endif
 
 // @section leveling
@@ -2204,6 +2312,37 @@
 // Moves (or segments) with fewer steps than this will be joined with the next move
 #define MIN_STEPS_PER_SEGMENT 6
 
+/**
+ * Merge short moves that go on in a nearly straight line into one planner block,
+ * for the dense output of some slicers. Every point merged away stays within
+ * COALESCE_TOLERANCE of the merged move, with its extrusion in place along it.
+ * Only moves at the same feedrate merge. Fewer blocks to plan, and the lookahead
+ * covers a longer path. M114 D reports the moves taken and the blocks they made.
+ * Not for DELTA, SCARA or POLARGRAPH.
+ */
+//#define COALESCE_SEGMENTS
+#if ENABLED(COALESCE_SEGMENTS)
+  #define COALESCE_TOLERANCE   0.005  // (mm) Farthest a merged point may be from the merged move
+  #define COALESCE_MAX_LENGTH  1.0    // (mm) Only moves shorter than this are merged
+  #define COALESCE_MAX_MOVES   16     // Most moves merged into one block
+  #define COALESCE_HOLD_MS     50     // (ms) Longest a move waits for the next one, unless the planner runs low first
+#endif
+
+/**
+ * Blend the corners between line moves, as with G64 P<tolerance> in CNC
+ * controllers. The corner is cut by an arc that passes within the tolerance of
+ * the vertex, queued as a few chords, so the toolhead keeps its speed through
+ * the turn instead of slowing to the junction speed. G64 P0 follows the exact
+ * path, which is the default at startup.
+ * Not for DELTA, SCARA, POLARGRAPH or COALESCE_SEGMENTS.
+ */
+//#define PATH_BLENDING
+#if ENABLED(PATH_BLENDING)
+  #define BLEND_TOLERANCE     0.05  // (mm) Tolerance for G64 without P
+  #define BLEND_MAX_SEGMENTS  8     // Most chords in a blend
+  #define BLEND_HOLD_MS       50    // (ms) Longest a move waits for the next one, unless the planner runs low first
+#endif
+
 /**
  * Minimum delay before and after setting the stepper DIR (in ns)
  *     0 : No delay (Expect at least 10µS since one Stepper ISR must transpire)
@@ -2268,6 +2407,21 @@
   #define BLOCK_BUFFER_SIZE 16
 #endif
 
+/**
+ * Time-based Planner Buffer
+ *
+ * With short segments a few blocks hold only milliseconds of motion, and the
+ * planner runs dry at the first hiccup in the G-code stream. Enable this to let
+ * BLOCK_BUFFER_SIZE go up to 128 and stop taking new moves once the queued moves
+ * take PLANNER_BUFFER_TIME to run, so long moves don't fill the larger buffer
+ * and a pause or cancel isn't delayed. For 32-bit boards.
+ */
+//#define PLANNER_TIME_BUFFER
+#if ENABLED(PLANNER_TIME_BUFFER)
+  #define PLANNER_BUFFER_TIME       250   // (ms) Motion to queue before holding new moves
+  #define PLANNER_BUFFER_MIN_MOVES    8   // Moves always taken, to keep lookahead over long moves
+#endif
+
 // @section serial
 
 // The ASCII buffer for serial input
@@ -2280,13 +2434,14 @@
 // For ADVANCED_OK (M105) you need 32 bytes.
 // For debug-echo: 128 bytes for the optimal speed.
 // Other output doesn't need to be that speedy.
+// Up to 8192 with SERIAL_DMA.
 // :[0, 2, 4, 8, 16, 32, 64, 128, 256]
 #define TX_BUFFER_SIZE 0
 
 // Host Receive Buffer Size
 // Without XON/XOFF flow control (see SERIAL_XON_XOFF below) 32 bytes should be enough.
 // To use flow control, set this buffer size to at least 1024 bytes.
-// :[0, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048]
+// :[0, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192]
 //#define RX_BUFFER_SIZE 1024
 
 #if RX_BUFFER_SIZE >= 1024
@@ -2295,6 +2450,23 @@
   //#define SERIAL_XON_XOFF
 #endif
 
+/**
+ * Serial DMA (STM32F1, STM32F4)
+ * The host serial port (SERIAL_PORT) receives into a circular DMA buffer of
+ * RX_BUFFER_SIZE and sends from the TX_BUFFER_SIZE ring by DMA, so no byte
+ * waits on an interrupt and a busy Stepper ISR can't make it drop any.
+ * An idle line hands the latest bytes to the Emergency Parser.
+ * Use a few KB of RX_BUFFER_SIZE with a high baud rate, tried with 'M575 S'.
+ *
+ * The DMA streams must not also be used by an SPI TFT:
+ *   STM32F4: USART1, USART6 and UART5 are free. USART2-UART4 share DMA1 with SPI2 and SPI3.
+ *   STM32F1: USART2 is free. USART1 and USART3 share DMA1 with SPI2 and SPI1.
+ */
+//#define SERIAL_DMA
+#if ENABLED(SERIAL_DMA)
+  //#define SERIAL_STATS_RX_BUFFER_OVERRUNS // Count receive errors that restarted the DMA, for M111
+#endif
+
 #if ENABLED(SDSUPPORT)
   // Enable this option to collect and display the maximum
   // RX queue usage after transferring a file to SD.
@@ -2350,6 +2522,18 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+/**
+ * Let the host send lines ahead with 'M110 N<line> W<lines>' instead of
+ * waiting for an "ok" per line. Lines are acknowledged with "ok N<line>"
+ * as they arrive and a lost line is asked for alone with "Resend: <line>".
+ * Lines after a lost line wait in the command queue, so they take up
+ * BUFSIZE slots. Over a UART the lines sent ahead must fit in RX_BUFFER_SIZE.
+ */
+//#define SERIAL_ACK_WINDOW
+#if ENABLED(SERIAL_ACK_WINDOW)
+  #define ACK_WINDOW_MAX 16   // Most lines a host may send ahead
+#endif
+
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
 #define SERIAL_OVERRUN_PROTECTION
@@ -3812,6 +3996,7 @@
 
 #if ENABLED(FASTER_GCODE_PARSER)
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+  //#define PARSED_COMMAND_QUEUE  // Parse commands as they are queued, so values are read without parsing. Uses ~100 bytes more SRAM per BUFSIZE.
 #endif
 
 // Support for MeatPack G-code compression (https://github.com/scottmudge/OctoPrint-MeatPack)
@@ -83,6 +83,16 @@ extern MSerialT usb_serial;
 #define HAL_ADC_VREF           5.0
 #define HAL_ADC_RESOLUTION    10
 
+// I2C
+#define HAL_ASYNC_I2C         // Thread-backed stand-in for the I2C queue backend
+
+// Stepping
+#define HAL_STEP_DMA          // Step pattern replay for the Fixed-Time Motion DMA backend
+
+// Host-side benchmark (benchmark.cpp) runs the stepper ISR from idle()
+extern bool benchmark_running;
+void benchmark_idle();
+
 // ------------------------
 // Class Utilities
 // ------------------------
@@ -122,7 +132,7 @@ public:
   static void delay_ms(const int ms) { _delay_ms(ms); }
 
   // Tasks, called from idle()
-  static void idletask() {}
+  static void idletask() { if (benchmark_running) benchmark_idle(); }
 
   // Reset
   static constexpr uint8_t reset_reason = RST_POWER_ON;
@@ -0,0 +1,969 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "../../MarlinCore.h"
+#include "../../gcode/parser.h"
+#include "../../gcode/queue.h"
+#include "../../module/motion.h"
+#if ENABLED(BINARY_MOTION_COMMANDS)
+  #include "../../feature/binary_motion.h"
+  #include "../../sd/cardreader.h"
+#endif
+#if ENABLED(FT_MOTION)
+  #include "../../module/ft_motion.h"
+#endif
+#if ENABLED(FTM_STEP_DMA)
+  #include "../shared/step_dma.h"
+#endif
+#include "../../module/planner.h"
+#include "../../module/settings.h"
+#include "../../module/stepper.h"
+#include "../../module/temperature.h"
+#include "hardware/Clock.h"
+#include "hardware/Gpio.h"
+#include "benchmark.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define BENCH_TSC 1
+#endif
+
+/**
+ * A minimal reader for recorded G-code. Only the state that changes the
+ * planned moves is tracked: G0/G1 targets and feedrate, G90/G91, G92 and M82/M83.
+ */
+class BenchMoveReader {
+public:
+  xyze_pos_t pos{0};
+  feedRate_t fr_mm_s = 50;
+
+  BenchMoveReader(const char * const path) : path(path) {
+    if (path) {
+      file = fopen(path, "r");
+      if (!file) fprintf(stderr, "Can't open %s\n", path);
+    }
+  }
+  ~BenchMoveReader() { if (file) fclose(file); }
+
+  // False if a file was named but can't be read
+  bool ok() const { return !path || file; }
+
+  // Get the next move. Return false at the end of the input.
+  bool next_move() {
+    return file ? next_file_move() : next_arc_move();
+  }
+
+private:
+  const char * const path;
+  FILE *file = nullptr;
+  bool relative = false, relative_e = false;
+  uint32_t arc_step = 0;
+
+  static bool word(const char * const line, const char letter, float &value) {
+    for (const char *p = line; *p; ++p)
+      if (*p == letter && (p == line || p[-1] == ' ' || p[-1] == '\t')) { value = strtof(p + 1, nullptr); return true; }
+    return false;
+  }
+
+  bool next_file_move() {
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+      char * const comment = strchr(line, ';');
+      if (comment) *comment = '\0';
+      const char *cmd = line;
+      while (*cmd == ' ' || *cmd == '\t') cmd++;
+
+      float v;
+      if (!strncmp(cmd, "G90", 3)) { relative = relative_e = false; continue; }
+      if (!strncmp(cmd, "G91", 3)) { relative = relative_e = true; continue; }
+      if (!strncmp(cmd, "M82", 3)) { relative_e = false; continue; }
+      if (!strncmp(cmd, "M83", 3)) { relative_e = true; continue; }
+      if (!strncmp(cmd, "G92", 3)) {
+        LOOP_LOGICAL_AXES(i) if (word(cmd, AXIS_CHAR(i), v)) pos[i] = v;
+        planner.set_position_mm(pos);
+        continue;
+      }
+      if ((cmd[0] == 'G' && (cmd[1] == '0' || cmd[1] == '1') && (cmd[2] < '0' || cmd[2] > '9'))) {
+        bool moved = false;
+        LOOP_LOGICAL_AXES(i) if (word(cmd, AXIS_CHAR(i), v)) {
+          const bool rel = TERN0(HAS_EXTRUDERS, i == E_AXIS) ? relative_e : relative;
+          pos[i] = rel ? pos[i] + v : v;
+          moved = true;
+        }
+        if (word(cmd, 'F', v) && v > 0) fr_mm_s = MMM_TO_MMS(v);
+        if (moved) return true;
+      }
+    }
+    return false;
+  }
+
+  // Dense small segments: 0.2mm chords around a 20mm circle, extruding
+  bool next_arc_move() {
+    constexpr uint32_t segments = 200000, per_turn = 628;
+    if (arc_step >= segments) return false;
+    const float a = float(arc_step % per_turn) * float(M_PI * 2) / per_turn;
+    pos.x = 100 + 20 * cosf(a);
+    pos.y = 100 + 20 * sinf(a);
+    TERN_(HAS_EXTRUDERS, pos.e += 0.0066f);
+    fr_mm_s = 100;
+    arc_step++;
+    return true;
+  }
+};
+
+// Fold the trapezoid of an executed block into the plan checksum
+static void checksum_block(uint64_t &sum, const block_t * const block) {
+  const uint32_t v[] = { block->initial_rate, block->final_rate, block->nominal_rate, block->accelerate_until, block->decelerate_after };
+  for (const uint32_t x : v) sum = (sum ^ x) * 0x100000001B3ULL;
+}
+
+// Stand in for the stepper ISR: take the oldest block if it's ready
+static bool consume_block(uint64_t &sum) {
+  block_t * const block = planner.get_current_block();
+  if (!block) return false;
+  if (block->is_move()) checksum_block(sum, block);
+  planner.release_current_block();
+  return true;
+}
+
+int planner_benchmark(const char * const path) {
+  BenchMoveReader reader(path);
+  if (!reader.ok()) return 1;
+
+  Clock::setFrequency(F_CPU);
+  settings.reset();
+  planner.init();
+  // The heaters aren't simulated here
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = true);
+  planner.set_position_mm(reader.pos);
+
+  uint64_t moves = 0, blocks = 0, checksum = 0xCBF29CE484222325ULL;
+  const auto start = std::chrono::steady_clock::now();
+
+  // Keep the buffer full, as when dense G-code saturates the planner
+  // A move may queue a held one first, and a blend, so leave room for all.
+  while (reader.next_move()) {
+    while (planner.moves_free() < TERN(PATH_BLENDING, (BLEND_MAX_SEGMENTS) + 1, TERN(COALESCE_SEGMENTS, 2, 1))) if (consume_block(checksum)) blocks++;
+    planner.buffer_line(reader.pos, reader.fr_mm_s);
+    moves++;
+  }
+  #if HAS_HELD_MOVE
+    while (!planner.moves_free()) if (consume_block(checksum)) blocks++;
+    planner.release_held_move();
+  #endif
+  while (planner.has_blocks_queued()) if (consume_block(checksum)) blocks++;
+
+  const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  printf("Planner benchmark: %s\n", path ? path : "built-in arc, 0.2mm segments");
+  printf("  BLOCK_BUFFER_SIZE: %d\n", BLOCK_BUFFER_SIZE);
+  printf("  moves: %llu  blocks: %llu  time: %.3fs\n", (unsigned long long)moves, (unsigned long long)blocks, secs);
+  printf("  blocks/s: %.0f  us/block: %.3f\n", secs > 0 ? blocks / secs : 0.0, blocks ? secs * 1e6 / blocks : 0.0);
+  printf("  plan checksum: %016llx\n", (unsigned long long)checksum);
+  return 0;
+}
+
+/**
+ * Full pipeline benchmark
+ *
+ * Lines go into the serial receive buffer as fast as it takes them, as from a
+ * host that never waits, and reach the planner through GCodeQueue and GcodeSuite.
+ *
+ * The stepper timer runs on virtual time. idle() calls benchmark_idle(), which
+ * runs Stepper::isr() for every interrupt that has fallen due. Virtual time moves
+ * on by the host time spent in the main loop, times the slowdown. While the main
+ * loop can only wait for the stepper (planner full or no more input) it skips
+ * ahead to the next interrupt, so a print runs as fast as the host allows.
+ */
+
+extern void loop();
+
+bool benchmark_running; // = false
+
+static struct {
+  float slowdown;
+  uint64_t vtime, next_isr;         // Virtual time in stepper timer ticks
+  uint64_t host_ns;                 // Host time of the last virtual time update
+  bool input_done;
+
+  uint64_t isr_calls, isr_ns, isr_cycles, blocks, steps;
+
+  // Planner starvation: the stepper ran out of blocks with commands pending
+  bool moving, starving;
+  uint32_t starved;
+  uint64_t starve_start, starved_ticks;
+
+  // Deviation of the stepped position from the segment of the running block
+  uint8_t seg_block;
+  xyz_long_t seg_start, seg_end;
+  float err_max;
+  double err_sum_sq;
+  uint64_t err_samples;
+
+  // Most steps between the stepped position and the stepper's count (input shaping lag)
+  int32_t lag_max;
+} bench;
+
+/**
+ * Step trace
+ *
+ * Follow the STEP and DIR pins of the XYZ steppers to get the position the
+ * motors really took. With input shaping it lags the stepper's count, and it
+ * must catch up with it when the echoes are done.
+ */
+class StepTrace : public IOLogger {
+public:
+  xyz_long_t pos;
+  uint64_t edges;
+  FILE *csv = nullptr;
+
+  void log(GpioEvent ev) override {
+    #define _TRACE_AXIS(A) \
+      if (ev.pin_id == A##_STEP_PIN) { \
+        if (ev.event != (INVERT_##A##_STEP_PIN ? GpioEvent::FALL : GpioEvent::RISE)) return; \
+        pos[_AXIS(A)] += Gpio::get(A##_DIR_PIN) == !INVERT_##A##_DIR ? 1 : -1; \
+        edges++; \
+        if (csv) fprintf(csv, "%llu,%ld,%ld,%ld\n", (unsigned long long)bench.vtime, long(pos.x), long(pos.y), long(pos.z)); \
+        return; \
+      }
+    _TRACE_AXIS(X)
+    _TRACE_AXIS(Y)
+    _TRACE_AXIS(Z)
+  }
+};
+
+static StepTrace step_trace;
+
+static bool bench_input_drained() {
+  return bench.input_done && !usb_serial.receive_buffer.available() && !queue.has_commands_queued();
+}
+
+static xyz_pos_t steps_to_mm(const xyz_long_t &steps) {
+  return { steps.x / planner.settings.axis_steps_per_mm[X_AXIS],
+           steps.y / planner.settings.axis_steps_per_mm[Y_AXIS],
+           steps.z / planner.settings.axis_steps_per_mm[Z_AXIS] };
+}
+
+static xyz_long_t stepper_position() {
+  return { stepper.position(X_AXIS), stepper.position(Y_AXIS), stepper.position(Z_AXIS) };
+}
+
+static int32_t trace_lag() {
+  const xyz_long_t d = stepper_position() - step_trace.pos;
+  return _MAX(ABS(d.x), ABS(d.y), ABS(d.z));
+}
+
+// Distance from p to the segment a-b
+static float segment_distance(const xyz_pos_t &p, const xyz_pos_t &a, const xyz_pos_t &b) {
+  const xyz_pos_t ab = b - a, ap = p - a;
+  const float len_sq = sq(ab.x) + sq(ab.y) + sq(ab.z),
+              t = len_sq > 0 ? constrain((ap.x * ab.x + ap.y * ab.y + ap.z * ab.z) / len_sq, 0.0f, 1.0f) : 0.0f;
+  return SQRT(sq(ap.x - ab.x * t) + sq(ap.y - ab.y * t) + sq(ap.z - ab.z * t));
+}
+
+#if ENABLED(FTM_CURVE_BLOCKS)
+
+  // Point of a curve block going from a to b, at the given fraction of its length
+  static xyz_pos_t curve_point(const ft_curve_t &curve, const xyz_pos_t &a, const xyz_pos_t &b, const float s) {
+    xyz_pos_t pt = a + (b - a) * s;
+    const xy_float_t c = curve.point(s);
+    pt[curve.axis_p] = a[curve.axis_p] + c.x;
+    pt[curve.axis_q] = a[curve.axis_q] + c.y;
+    return pt;
+  }
+
+  // Distance from p to a curve block. Sample 32 points, then refine every local minimum by ternary search.
+  static float curve_distance(const xyz_pos_t &p, const ft_curve_t &curve, const xyz_pos_t &a, const xyz_pos_t &b) {
+    auto dist = [&](const float s) { const xyz_pos_t d = curve_point(curve, a, b, s) - p; return SQRT(sq(d.x) + sq(d.y) + sq(d.z)); };
+    constexpr uint8_t pieces = 32;
+    float d[pieces + 1];
+    LOOP_LE_N(i, pieces) d[i] = dist(float(i) / pieces);
+
+    float best = d[0];
+    LOOP_LE_N(i, pieces) {
+      if ((i && d[i - 1] < d[i]) || (i < pieces && d[i + 1] < d[i])) continue;
+      float lo = float(_MAX(i - 1, 0)) / pieces, hi = float(_MIN(i + 1, pieces)) / pieces;
+      LOOP_L_N(n, 24) {
+        const float m1 = lo + (hi - lo) / 3, m2 = hi - (hi - lo) / 3;
+        if (dist(m1) < dist(m2)) hi = m2; else lo = m1;
+      }
+      best = _MIN(best, d[i], dist(0.5f * (lo + hi)));
+    }
+    return best;
+  }
+
+#endif
+
+// End of a block's path, in steps, from its start
+static xyz_long_t block_end(const uint8_t index, const xyz_long_t &start) {
+  const block_t &block = planner.block_buffer[index];
+  xyz_long_t end;
+  LOOP_L_N(a, XYZ) {
+    const int32_t steps = block.steps[a];
+    end[a] = start[a] + (TEST(block.direction_bits, a) ? -steps : steps);
+  }
+  #if ENABLED(FTM_CURVE_BLOCKS)
+    if (block.flag.curve) {
+      const ft_curve_t &curve = FTMotion::curves[index];
+      end[curve.axis_p] = start[curve.axis_p] + curve.chord.x;
+      end[curve.axis_q] = start[curve.axis_q] + curve.chord.y;
+    }
+  #endif
+  return end;
+}
+
+// Distance from p to the path of a block
+static float path_distance(const uint8_t index, const xyz_pos_t &p, const xyz_long_t &start, const xyz_long_t &end) {
+  #if ENABLED(FTM_CURVE_BLOCKS)
+    if (planner.block_buffer[index].flag.curve)
+      return curve_distance(p, FTMotion::curves[index], steps_to_mm(start), steps_to_mm(end));
+  #endif
+  return segment_distance(p, steps_to_mm(start), steps_to_mm(end));
+}
+
+static void bench_track_block() {
+  const uint8_t tail = planner.block_buffer_tail;
+  if (planner.block_buffer_nonbusy == tail) { bench.seg_block = 0xFF; return; }
+
+  block_t &block = planner.block_buffer[tail];
+  if (!block.is_move()) return;
+
+  // A new block started. Its segment continues the last one unless the stepper was idle.
+  if (bench.seg_block != tail) {
+    if (bench.seg_block == 0xFF)
+      bench.seg_start = stepper_position();
+    else {
+      // Fixed-Time Motion can finish several blocks in one interrupt, so go through the skipped ones
+      for (uint8_t b = BLOCK_MOD(bench.seg_block + 1); b != tail; b = BLOCK_MOD(b + 1))
+        if (planner.block_buffer[b].is_move()) bench.seg_end = block_end(b, bench.seg_end);
+      bench.seg_start = bench.seg_end;
+    }
+    bench.seg_end = block_end(tail, bench.seg_start);
+    bench.seg_block = tail;
+  }
+
+  const xyz_pos_t pos = steps_to_mm(step_trace.pos);
+  float err = path_distance(tail, pos, bench.seg_start, bench.seg_end);
+
+  // Fixed-Time Motion frees a block at the end of its last frame, when the next one may have begun
+  #if ENABLED(FT_MOTION)
+    const uint8_t next = BLOCK_MOD(tail + 1);
+    if (err > 0 && FTMotion::active && next != planner.block_buffer_nonbusy && planner.block_buffer[next].is_move())
+      NOMORE(err, path_distance(next, pos, bench.seg_end, block_end(next, bench.seg_end)));
+  #endif
+
+  NOLESS(bench.err_max, err);
+  bench.err_sum_sq += sq(err);
+  bench.err_samples++;
+}
+
+static void bench_isr() {
+  const uint8_t tail = planner.block_buffer_tail;
+
+  #if ENABLED(FTM_STEP_DMA)
+    // Play the pattern words due by this interrupt, each at its own time for the trace
+    const uint64_t vtime = bench.vtime;
+    step_dma_run(bench.next_isr, [](const uint64_t tick) { bench.vtime = tick; });
+    bench.vtime = vtime;
+  #endif
+
+  #if BENCH_TSC
+    const uint64_t c0 = __rdtsc();
+  #endif
+  const uint64_t t0 = Clock::nanos();
+  Stepper::isr();
+  bench.isr_ns += Clock::nanos() - t0;
+  TERN_(BENCH_TSC, bench.isr_cycles += __rdtsc() - c0);
+  bench.isr_calls++;
+
+  const hal_timer_t interval = HAL_timer_get_compare(MF_TIMER_STEP);
+  bench.next_isr += interval ? interval : 1;
+
+  // Count the blocks done in this interrupt
+  for (uint8_t b = tail; b != planner.block_buffer_tail; b = BLOCK_MOD(b + 1)) {
+    block_t &block = planner.block_buffer[b];
+    if (block.is_move()) { bench.blocks++; bench.steps += block.step_event_count; }
+    if (bench.seg_block == b) bench.seg_block = 0xFF;
+  }
+
+  const bool moving = planner.has_blocks_queued();
+  if (bench.moving && !moving && !bench_input_drained()) {
+    bench.starved++;
+    bench.starving = true;
+    bench.starve_start = bench.vtime;
+  }
+  else if (moving && bench.starving) {
+    bench.starving = false;
+    bench.starved_ticks += bench.vtime - bench.starve_start;
+  }
+  bench.moving = moving;
+
+  bench_track_block();
+  NOLESS(bench.lag_max, trace_lag());
+}
+
+void benchmark_idle() {
+  const uint64_t now = Clock::nanos();
+  bench.vtime += uint64_t((now - bench.host_ns) * bench.slowdown * (STEPPER_TIMER_RATE / 1e9));
+
+  if (STEPPER_ISR_ENABLED()) {
+    // Nothing for the main loop to do but wait for the stepper
+    while (!planner.moves_free() || (bench_input_drained() && planner.busy())) {
+      TERN_(FT_MOTION, ftMotion.loop());
+      NOLESS(bench.vtime, bench.next_isr);
+      bench_isr();
+    }
+    while (bench.next_isr <= bench.vtime) bench_isr();
+  }
+
+  bench.host_ns = Clock::nanos();
+}
+
+// Commands the benchmark leaves out: homing, probing and heater waits
+static bool bench_skip_command(const char * const cmd) {
+  static const char * const skip[] = { "G28", "G29", "M109", "M190", "M191", "M303" };
+  for (const char * const s : skip) {
+    const size_t n = strlen(s);
+    if (!strncmp(cmd, s, n) && !NUMERIC(cmd[n])) return true;
+  }
+  return false;
+}
+
+// Trim a line from a file down to its command, moved to the start. Return its length, 0 to skip it.
+static size_t bench_command(char * const line) {
+  char * const comment = strchr(line, ';');
+  if (comment) *comment = '\0';
+  const char *cmd = line;
+  while (*cmd == ' ' || *cmd == '\t') cmd++;
+  size_t len = strlen(cmd);
+  while (len && (ISEOL(cmd[len - 1]) || cmd[len - 1] == ' ' || cmd[len - 1] == '\t')) len--;
+  if (!len || bench_skip_command(cmd)) return 0;
+  memmove(line, cmd, len);
+  line[len] = '\0';
+  return len;
+}
+
+int pipeline_benchmark(const char * const path, const float slowdown, const char * const trace_path/*=nullptr*/) {
+  FILE * const file = fopen(path, "r");
+  if (!file) { fprintf(stderr, "Can't open %s\n", path); return 1; }
+
+  bench = {};
+  bench.slowdown = _MAX(slowdown, 0.0f);
+  bench.seg_block = 0xFF;
+
+  step_trace.pos = stepper_position();
+  if (trace_path) {
+    step_trace.csv = fopen(trace_path, "w");
+    if (step_trace.csv) fprintf(step_trace.csv, "ticks,x,y,z\n");
+  }
+  Gpio::attachLogger(&step_trace);
+
+  // The axes aren't homed and the heaters don't get hot here
+  set_all_homed();
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = true);
+
+  uint64_t commands = 0;
+  char line[MAX_CMD_SIZE + 2];
+  size_t len = 0;
+  bool pending = false;
+
+  const auto start = std::chrono::steady_clock::now();
+  bench.host_ns = Clock::nanos();
+  benchmark_running = true;
+
+  for (;;) {
+    // Send whole lines while the receive buffer has room
+    while (!bench.input_done) {
+      if (!pending) {
+        if (!fgets(line, sizeof(line) - 1, file)) { bench.input_done = true; break; }
+        if (!(len = bench_command(line))) continue;
+        line[len++] = '\n';
+        pending = true;
+      }
+      if (usb_serial.receive_buffer.free() < len) break;
+      LOOP_L_N(i, len) usb_serial.receive_buffer.write(line[i]);
+      pending = false;
+      commands++;
+    }
+
+    if (bench_input_drained() && !planner.busy()) break;
+
+    loop();
+  }
+
+  benchmark_running = false;
+  Gpio::attachLogger(nullptr);
+  fclose(file);
+  if (step_trace.csv) fclose(step_trace.csv);
+
+  const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(),
+               vsecs = bench.vtime / double(STEPPER_TIMER_RATE);
+
+  printf("Pipeline benchmark: %s (slowdown %.1f)\n", path, bench.slowdown);
+  printf("  BLOCK_BUFFER_SIZE: %d  BUFSIZE: %d\n", BLOCK_BUFFER_SIZE, BUFSIZE);
+  printf("  commands: %llu  blocks: %llu  steps: %llu\n", (unsigned long long)commands, (unsigned long long)bench.blocks, (unsigned long long)bench.steps);
+  printf("  host time: %.3fs  print time: %.3fs  (%.1fx real time)\n", secs, vsecs, secs > 0 ? vsecs / secs : 0.0);
+  printf("  commands/s: %.0f  blocks/s: %.0f\n", secs > 0 ? commands / secs : 0.0, secs > 0 ? bench.blocks / secs : 0.0);
+  printf("  stepper ISR: %llu calls  %.1f ns/step", (unsigned long long)bench.isr_calls, bench.steps ? double(bench.isr_ns) / bench.steps : 0.0);
+  #if BENCH_TSC
+    printf("  %.0f cycles/step", bench.steps ? double(bench.isr_cycles) / bench.steps : 0.0);
+  #endif
+  printf("\n");
+  #if ENABLED(COALESCE_SEGMENTS)
+    printf("  coalesced: %lu moves in %lu blocks  (%.2f:1)\n", (unsigned long)planner.coalesce_moves, (unsigned long)planner.coalesce_blocks,
+      planner.coalesce_blocks ? double(planner.coalesce_moves) / planner.coalesce_blocks : 0.0);
+  #endif
+  printf("  planner starvation: %lu events  %.3fs\n", (unsigned long)bench.starved, bench.starved_ticks / double(STEPPER_TIMER_RATE));
+  printf("  trajectory error: max %.4fmm  rms %.4fmm\n", bench.err_max, bench.err_samples ? sqrt(bench.err_sum_sq / bench.err_samples) : 0.0);
+
+  // The traced steps must end where the stepper counted them
+  const xyz_long_t end = stepper_position();
+  const bool trace_ok = end == step_trace.pos;
+  printf("  step trace: %llu steps  lag max %ld steps  end X%ld Y%ld Z%ld  %s\n",
+    (unsigned long long)step_trace.edges, long(bench.lag_max),
+    long(step_trace.pos.x), long(step_trace.pos.y), long(step_trace.pos.z),
+    trace_ok ? "ok" : "MISMATCH");
+  #if HAS_SHAPING
+    LOOP_L_N(a, 2) {
+      const AxisEnum axis = AxisEnum(a);
+      if (!stepper.get_shaping_frequency(axis)) continue;
+      static const char * const types[] = { "ZV", "ZVD", "MZV", "EI" };
+      printf("  %c shaping: %s %.1fHz zeta %.2f\n", AXIS_CHAR(axis), types[stepper.get_shaping_type(axis)],
+        stepper.get_shaping_frequency(axis), stepper.get_shaping_damping_ratio(axis));
+    }
+  #endif
+  return trace_ok ? 0 : 2;
+}
+
+/**
+ * Command throughput benchmark
+ *
+ * The commands of a G-code file go into the serial receive buffer as numbered
+ * text with checksums, as from a host, and through GCodeQueue and the parser.
+ * Every parameter value is read and "ok" sent, but the commands aren't run. With
+ * PARSED_COMMAND_QUEUE the values read from the records are checked against the
+ * text. With BINARY_MOTION_COMMANDS the same commands go again as binary stream
+ * packets.
+ */
+
+// Fold the command in the parser, with all of its values, into a checksum
+static void bench_read_command(uint64_t &sum) {
+  auto mix = [&](const uint32_t x) { sum = (sum ^ x) * 0x100000001B3ULL; };
+  mix(parser.command_letter);
+  mix(parser.codenum);
+  for (char c = 'A'; c <= 'Z'; ++c) {
+    if (!parser.seen(c)) continue;
+    const float v = parser.value_float() + 0.0f; // No -0
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    mix(c);
+    mix(parser.has_value());
+    mix(bits);
+  }
+}
+
+struct BenchCommandPass {
+  uint64_t bytes, ns, commands, records, sum;
+};
+
+// Send the frames (lines or packets) as the receive buffer takes them.
+// With 'from_text' the queued records are ignored and the text is parsed.
+static BenchCommandPass bench_command_pass(const std::vector<std::string> &frames, const bool from_text=false) {
+  BenchCommandPass pass = { 0, 0, 0, 0, 0xCBF29CE484222325ULL };
+  auto &ring = queue.ring_buffer;
+  size_t i = 0;
+  while (i < frames.size() || usb_serial.receive_buffer.available()) {
+    while (i < frames.size() && usb_serial.receive_buffer.free() >= frames[i].size()) {
+      for (const char c : frames[i]) usb_serial.receive_buffer.write(c);
+      pass.bytes += frames[i++].size();
+    }
+    // Let the output thread take the replies, so no write waits for it
+    while (usb_serial.transmit_buffer.available()) std::this_thread::yield();
+
+    const uint64_t start_ns = Clock::nanos();
+    queue.get_available_commands();
+    for (; ring.occupied(); ring.advance_pos(ring.index_r, -1)) {
+      GCodeQueue::CommandLine &command = ring.peek_next_command();
+      #if HAS_GCODE_RECORDS
+        if (command.has_record && !from_text) {
+          parser.load(command.record, TERN(PARSED_COMMAND_QUEUE, command.buffer + command.record.command, nullptr));
+          pass.records++;
+        }
+        else
+      #else
+        UNUSED(from_text);
+      #endif
+          parser.parse(command.buffer);
+      bench_read_command(pass.sum);
+      ring.ok_to_send();
+      pass.commands++;
+    }
+    pass.ns += Clock::nanos() - start_ns;
+  }
+  return pass;
+}
+
+#if ENABLED(BINARY_MOTION_COMMANDS)
+
+  static void bench_varint(std::string &out, uint32_t v) {
+    for (; v >= 0x80; v >>= 7) out += char(v | 0x80);
+    out += char(v);
+  }
+
+  // Pre-tokenize a command as MarlinBinaryProtocol.py does. False if it must go as text.
+  static bool bench_tokenize(const char *p, std::string &out) {
+    const char letter = *p++;
+    if (!NUMERIC(*p)) return false;
+    uint32_t codenum = 0;
+    while (NUMERIC(*p)) codenum = codenum * 10 + *p++ - '0';
+    if ((*p && *p != ' ') || !BinaryMotionProtocol::tokenized(letter, codenum)) return false;
+
+    static const char params[] = BINARY_MOTION_PARAMS;
+    uint32_t valuebits = 0, flagbits = 0, value[26];
+    uint8_t count = 0;
+    for (;;) {
+      while (*p == ' ') p++;
+      if (!*p) break;
+      const char * const param = strchr(params, *p++);
+      if (!param || !*param) return false;
+      const uint8_t b = param - params;
+      if (TEST32(valuebits | flagbits, b)) return false;
+      if (!*p || *p == ' ') { SBI32(flagbits, b); continue; }
+
+      // Decimal fixed-point, without trailing zeros. A mantissa under 2^24
+      // is an exact float, so the firmware's divide rounds as strtof does.
+      const bool neg = *p == '-';
+      if (*p == '-' || *p == '+') p++;
+      uint64_t mantissa = 0;
+      uint8_t decimals = 0, digits = 0;
+      bool point = false;
+      for (;; p++) {
+        if (NUMERIC(*p)) {
+          if (++digits > 15) return false;
+          mantissa = mantissa * 10 + *p - '0';
+          if (point) decimals++;
+        }
+        else if (*p == '.' && !point) point = true;
+        else break;
+      }
+      if (!digits || (*p && *p != ' ') || ++count > GCODE_RECORD_VALUES) return false;
+      for (; decimals && mantissa % 10 == 0; decimals--) mantissa /= 10;
+      if (mantissa >= _BV32(24) || decimals > GCODE_RECORD_DECIMALS) return false;
+      SBI32(valuebits, b);
+      const uint32_t zigzag = neg && mantissa ? uint32_t(mantissa) * 2 - 1 : uint32_t(mantissa) * 2;
+      value[b] = (zigzag << 3) | decimals;
+    }
+
+    out += char(letter | (flagbits ? 0x80 : 0));
+    bench_varint(out, codenum);
+    bench_varint(out, valuebits);
+    if (flagbits) bench_varint(out, flagbits);
+    LOOP_L_N(b, 26) if (TEST32(valuebits, b)) bench_varint(out, value[b]);
+    return true;
+  }
+
+  // A binary stream packet, with its Fletcher-16 checksums
+  static std::string bench_packet(const uint8_t sync, const uint8_t protocol, const uint8_t type, const std::string &data) {
+    std::string pkt = { char(0xAD), char(0xB5), char(sync), char((protocol << 4) | type), char(data.size() & 0xFF), char(data.size() >> 8) };
+    uint16_t lo = 0, hi = 0;
+    auto add = [&](const uint8_t b) { lo = (lo + b) % 255; hi = (hi + lo) % 255; };
+    for (size_t i = 2; i < pkt.size(); i++) add(pkt[i]);
+    const uint8_t header_lo = lo, header_hi = hi;
+    pkt += char(header_lo); pkt += char(header_hi);
+    if (data.size()) {
+      add(header_lo); add(header_hi);
+      for (const char c : data) add(c);
+      pkt += data;
+      pkt += char(lo); pkt += char(hi);
+    }
+    return pkt;
+  }
+
+#endif // BINARY_MOTION_COMMANDS
+
+int command_benchmark(const char * const path) {
+  FILE * const file = fopen(path, "r");
+  if (!file) { fprintf(stderr, "Can't open %s\n", path); return 1; }
+  std::vector<std::string> commands;
+  char line[MAX_CMD_SIZE + 2];
+  while (fgets(line, sizeof(line), file))
+    if (bench_command(line)) commands.push_back(line);
+  fclose(file);
+
+  // As from a host, with line numbers and checksums
+  std::vector<std::string> text;
+  queue.set_current_line_number(0);
+  for (const std::string &cmd : commands) {
+    char numbered[MAX_CMD_SIZE + 16];
+    int len = sprintf(numbered, "N%lu %s", (unsigned long)text.size() + 1, cmd.c_str());
+    uint8_t checksum = 0;
+    LOOP_L_N(i, len) checksum ^= numbered[i];
+    sprintf(numbered + len, "*%u\n", checksum);
+    text.push_back(numbered);
+  }
+
+  const BenchCommandPass ascii = bench_command_pass(text);
+  const double bytes_per_s = BAUDRATE / 10.0; // 8N1
+
+  printf("Command benchmark: %s\n", path);
+  printf("  commands: %llu  BUFSIZE: %d  BAUDRATE: %ld\n", (unsigned long long)ascii.commands, BUFSIZE, long(BAUDRATE));
+  auto report = [&](const char * const name, const BenchCommandPass &pass) {
+    const double bytes = pass.commands ? double(pass.bytes) / pass.commands : 0, ns = pass.commands ? double(pass.ns) / pass.commands : 0;
+    printf("  %-7s %5.1f bytes/command  %7.0f commands/s on the wire  %6.0f ns/command  %8.0f commands/s in the firmware\n",
+      name, bytes, bytes ? bytes_per_s / bytes : 0.0, ns, ns ? 1e9 / ns : 0.0);
+  };
+  report("ASCII:", ascii);
+
+  #if ENABLED(PARSED_COMMAND_QUEUE)
+    // The same commands again, parsed from the text as they're run
+    queue.set_current_line_number(0);
+    const BenchCommandPass parsed = bench_command_pass(text, true);
+    const bool parsed_match = parsed.commands == ascii.commands && parsed.sum == ascii.sum;
+    printf("  parsed when queued: %llu  parsed when run: %llu  values: %s\n", (unsigned long long)ascii.records,
+      (unsigned long long)(ascii.commands - ascii.records), parsed_match ? "match" : "MISMATCH");
+    if (!parsed_match) return 2;
+  #endif
+
+  #if ENABLED(BINARY_MOTION_COMMANDS)
+    // 'M28 B1' and a SYNC, then packets of commands, then a CLOSE
+    std::vector<std::string> packets = { bench_packet(0, 0, 1, "") };
+    uint8_t sync = 0;
+    uint32_t tokenized = 0;
+    std::string payload(1, '\0');
+    auto send_payload = [&]{
+      if (!payload[0]) return;
+      packets.push_back(bench_packet(sync++, 2, uint8_t(BinaryMotionProtocol::Packet::COMMANDS), payload));
+      payload.assign(1, '\0');
+    };
+    for (const std::string &cmd : commands) {
+      std::string rec;
+      if (bench_tokenize(cmd.c_str(), rec))
+        tokenized++;
+      else {
+        rec.assign(1, '\0');
+        rec += cmd;
+        rec += '\0';
+      }
+      if (uint8_t(payload[0]) == BUFSIZE || payload.size() + rec.size() > MAX_CMD_SIZE) send_payload();
+      payload += rec;
+      payload[0]++;
+    }
+    send_payload();
+    packets.push_back(bench_packet(sync, 0, 2, ""));
+
+    card.flag.binary_mode = true;
+    const BenchCommandPass binary = bench_command_pass(packets);
+    report("binary:", binary);
+
+    const bool match = binary.commands == ascii.commands && binary.sum == ascii.sum;
+    printf("  pre-tokenized: %lu  as text: %lu  values: %s\n", (unsigned long)tokenized, (unsigned long)(commands.size() - tokenized), match ? "match" : "MISMATCH");
+    return match ? 0 : 2;
+  #else
+    return 0;
+  #endif
+}
+
+/**
+ * Number parser benchmark
+ *
+ * Check GCodeParser::parse_float() bit for bit against strtof, as value_float
+ * used it, on random numbers of every shape it handles: short G-code values,
+ * long mantissas, ties and near-ties between floats, and the odd cases left to
+ * strtof. Then time both on the values of a G-code file, or on random G-code
+ * values.
+ */
+
+// value_float before parse_float: strtof, with the text cut at an 'E'
+static float bench_strtof(char * const str) {
+  for (char *e = str; ; ++e) {
+    const char c = *e;
+    if (c == '\0' || c == ' ') break;
+    if (c == 'E' || c == 'e') {
+      *e = '\0';
+      const float ret = strtof(str, nullptr);
+      *e = c;
+      return ret;
+    }
+  }
+  return strtof(str, nullptr);
+}
+
+struct BenchRandom {
+  uint64_t s = 0x9E3779B97F4A7C15ULL;
+  uint32_t next() { s ^= s << 13; s ^= s >> 7; s ^= s << 17; return uint32_t(s >> 16); }
+  uint32_t below(const uint32_t n) { return next() % n; }
+};
+
+static void bench_digits(std::string &out, BenchRandom &rnd, const uint8_t count) {
+  LOOP_L_N(i, count) out += char('0' + rnd.below(10));
+}
+
+// A value as a slicer writes it: a few digits each side of the point
+static std::string bench_gcode_value(BenchRandom &rnd) {
+  std::string v;
+  if (rnd.below(4) == 0) v += '-';
+  bench_digits(v, rnd, 1 + rnd.below(4));
+  const uint8_t places = rnd.below(6);
+  if (places) { v += '.'; bench_digits(v, rnd, places); }
+  return v;
+}
+
+static std::string bench_fuzz_value(BenchRandom &rnd) {
+  char buf[80];
+  switch (rnd.below(6)) {
+    default: return bench_gcode_value(rnd);
+
+    case 1: {                                   // Long mantissas, leading and trailing zeros
+      std::string v;
+      if (rnd.below(2)) v += rnd.below(2) ? '-' : '+';
+      if (rnd.below(4) == 0) v.append(rnd.below(4), '0');
+      bench_digits(v, rnd, rnd.below(12));
+      if (rnd.below(4)) { v += '.'; bench_digits(v, rnd, rnd.below(16)); }
+      if (rnd.below(4) == 0) v.append(rnd.below(6), '0');
+      if (v.find_first_of("0123456789") == std::string::npos) v += '7';
+      return v;
+    }
+
+    case 2: case 3: {                           // Ties and near-ties between two floats
+      float a;
+      uint32_t bits;
+      do {
+        bits = rnd.next() & 0x7FFFFFFF;
+        memcpy(&a, &bits, sizeof(a));
+      } while (!(a >= 1e-8f && a <= 1e12f));
+      const float b = nextafterf(a, 1e30f);
+      const double mid = (double(a) + double(b)) / 2;
+      const int digits = rnd.below(3) == 0 ? 40 : 9 + rnd.below(10);
+      sprintf(buf, "%.*g", digits, mid);
+      // Only plain decimals. parse_float stops at an exponent.
+      if (strchr(buf, 'e')) sprintf(buf, "%.*f", 8 + rnd.below(20), mid);
+      return buf;
+    }
+
+    case 4: {                                   // Random float, shortest-ish form
+      float a;
+      uint32_t bits;
+      do {
+        bits = rnd.next() & 0x7FFFFFFF;
+        memcpy(&a, &bits, sizeof(a));
+      } while (!(a >= 1e-6f && a <= 1e9f));
+      sprintf(buf, "%s%.*f", rnd.below(2) ? "-" : "", int(rnd.below(12)), a);
+      return buf;
+    }
+
+    case 5: {                                   // The odd cases
+      static const char * const odd[] = {
+        "0", "-0", "+0", "-0.000", "0x1A", "0X10", "1e5", "1E-3", "-2.5e3", "-.5", "+.5", "5.", ".0", "1..5",
+        "00000.000100", "1.5e", "16777217", "16777216.5", "2147483648", "9007199254740993", "18446744073709551617",
+        "340282356779733661637539395458142568448", "0.000000000000000000000000000000000000000000001",
+        "0.0000000000000000000000000000000000000117549435", "3.4028235677973366e38"
+      };
+      return odd[rnd.below(COUNT(odd))];
+    }
+  }
+}
+
+int parser_benchmark(const char * const path) {
+  // Check against strtof
+  BenchRandom rnd;
+  const uint32_t checks = 2000000;
+  uint32_t mismatches = 0, fixed = 0;
+  char buf[128];
+  for (uint32_t i = 0; i < checks; ++i) {
+    strcpy(buf, bench_fuzz_value(rnd).c_str());
+    const float ref = bench_strtof(buf), got = GCodeParser::parse_float(buf);
+    bool ok = !memcmp(&ref, &got, sizeof(ref));
+    int32_t m;
+    uint8_t d;
+    if (GCodeParser::fixed_point(buf, m, d)) {
+      static constexpr int32_t pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+      const float f = float(m) / float(pow10[d]);
+      ok = ok && !memcmp(&ref, &f, sizeof(ref)) && m / pow10[d] == int32_t(strtol(buf, nullptr, 10));
+      fixed++;
+    }
+    if (!ok && ++mismatches <= 10)
+      printf("  MISMATCH: \"%s\" strtof %.9g parse_float %.9g\n", buf, double(ref), double(got));
+  }
+
+  // Values to time, from a file or made up
+  std::vector<std::string> values;
+  if (path) {
+    FILE * const file = fopen(path, "r");
+    if (!file) { fprintf(stderr, "Can't open %s\n", path); return 1; }
+    char line[MAX_CMD_SIZE + 2];
+    while (fgets(line, sizeof(line), file)) {
+      if (!bench_command(line)) continue;
+      for (char *p = strchr(line, ' '); p; p = strchr(p, ' ')) {
+        while (*p == ' ') p++;
+        if (WITHIN(*p, 'A', 'Z') && GCodeParser::valid_float(p + 1)) {
+          const char * const end = strchr(p, ' ');
+          values.emplace_back(p + 1, end ? end - p - 1 : strlen(p + 1));
+        }
+      }
+    }
+    fclose(file);
+  }
+  else
+    for (uint32_t i = 0; i < 1000000; ++i) values.push_back(bench_gcode_value(rnd));
+
+  // A copy to parse in place, as value_float does
+  std::vector<char> text;
+  std::vector<size_t> starts;
+  for (const std::string &v : values) {
+    starts.push_back(text.size());
+    text.insert(text.end(), v.begin(), v.end());
+    text.push_back('\0');
+  }
+
+  auto time_ns = [&](float (*parse)(char * const)) {
+    double best = 1e30, sum = 0;
+    LOOP_L_N(run, 5) {
+      const auto start = std::chrono::steady_clock::now();
+      for (const size_t at : starts) sum += parse(&text[at]);
+      const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+      NOMORE(best, ns);
+    }
+    if (sum == 1.5) printf(" ");               // Keep the sum
+    return starts.empty() ? 0 : best / starts.size();
+  };
+  const double strtof_ns = time_ns(bench_strtof), parse_ns = time_ns(GCodeParser::parse_float);
+
+  printf("Number parser benchmark: %s\n", path ? path : "random G-code values");
+  printf("  checked: %lu  fixed-point: %lu  mismatches: %lu\n", (unsigned long)checks, (unsigned long)fixed, (unsigned long)mismatches);
+  printf("  values: %lu  strtof: %.1f ns/value  parse_float: %.1f ns/value  (%.1fx)\n",
+    (unsigned long)starts.size(), strtof_ns, parse_ns, parse_ns > 0 ? strtof_ns / parse_ns : 0.0);
+  return mismatches ? 2 : 0;
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Host-side benchmarks for the LINUX HAL
+ *
+ *   marlin --bench-planner [file.gcode]
+ *
+ * Feed the G0/G1 moves of a G-code file (or a built-in dense arc pattern)
+ * straight into Planner::buffer_line() and report the planning throughput.
+ *
+ *   marlin --bench-parser [file.gcode]
+ *
+ * Check GCodeParser::parse_float() against strtof on millions of random
+ * numbers, then time both on the values of a G-code file (or random G-code
+ * values). The run fails on any difference.
+ *
+ *   marlin --bench file.gcode [slowdown] [trace.csv]
+ *
+ * Run a G-code file through the whole firmware: serial input, GCodeQueue,
+ * GcodeSuite, the planner and the stepper ISR on a virtual clock. Report
+ * the command and block rates, ISR cost per step, planner starvation and
+ * the deviation of the stepped path from the planned segments.
+ * Main loop time is scaled by 'slowdown' to model a slower MCU.
+ * The XYZ steps are traced on the STEP/DIR pins, optionally into a CSV file,
+ * and the run fails if they don't end on the stepper's position.
+ *
+ *   marlin --bench-commands file.gcode
+ *
+ * Send the commands of a G-code file as numbered text with checksums, and
+ * with BINARY_MOTION_COMMANDS again as binary stream packets. The commands
+ * are parsed and all their values read, but not run. Report the bytes per
+ * command, the command rate the wire allows at BAUDRATE and the firmware
+ * time per command. With PARSED_COMMAND_QUEUE the text is sent a second time
+ * and parsed as it runs. The run fails if any two ways give different values.
+ */
+
+int planner_benchmark(const char * const path);
+int parser_benchmark(const char * const path);
+int pipeline_benchmark(const char * const path, const float slowdown, const char * const trace_path=nullptr);
+int command_benchmark(const char * const path);
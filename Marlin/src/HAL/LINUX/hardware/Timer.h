@@ -38,9 +38,11 @@ public:
   typedef void (callback_fn)();
 
   void init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn);
+  void initVirtual(uint32_t sim_freq);
   void start(uint32_t frequency);
   void enable();
   bool enabled() {return active;}
+  bool isVirtual() {return virtual_time;}
   void disable();
   void setCompare(uint32_t compare);
   uint32_t getCount();
@@ -64,6 +66,7 @@ public:
 
 private:
   bool active;
+  bool virtual_time; // No POSIX timer. The owner calls the ISR and reads the compare value.
   uint32_t compare;
   uint32_t frequency;
   uint32_t overruns;
@@ -73,4 +76,5 @@ private:
   uint64_t period;
   uint64_t avg_error;
   uint64_t start_time;
+  uint64_t last_read;  // Virtual: host time of the last count read
 };
@@ -0,0 +1,94 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(I2C_ASYNC_QUEUE)
+
+/**
+ * Thread-backed stand-in for an I2C controller.
+ *
+ * A worker thread takes the job started by the queue and completes it after
+ * the time the transfer would take on a 100kHz bus. The bus has no devices:
+ * every byte is acknowledged and reads return 0xFF, like an idle bus.
+ */
+
+#include "../shared/i2c_async.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+static std::atomic<I2CJob*> i2c_pending{nullptr};
+static std::atomic<bool> i2c_done{false};
+static millis_t deadline_ms;
+
+static void i2c_worker() {
+  for (;;) {
+    I2CJob * const job = i2c_pending.load(std::memory_order_acquire);
+    if (job && !i2c_done.load(std::memory_order_acquire)) {
+      // Address byte plus data bytes, 9 clocks each
+      const uint32_t bytes = (job->tx_len ? 1 + job->tx_len : 0) + (job->rx_len ? 1 + job->rx_len : 0);
+      std::this_thread::sleep_for(std::chrono::microseconds(bytes * 9 * 10));
+      LOOP_L_N(i, job->rx_len) job->rx[i] = 0xFF;
+      // Skip the completion if the job was aborted meanwhile
+      if (i2c_pending.load(std::memory_order_acquire) == job)
+        i2c_done.store(true, std::memory_order_release);
+    }
+    else
+      std::this_thread::yield();
+  }
+}
+
+void i2c_backend_init() {
+  static bool started = false;
+  if (!started) {
+    std::thread(i2c_worker).detach();
+    started = true;
+  }
+}
+
+bool i2c_backend_start(I2CJob &job) {
+  deadline_ms = millis() + I2C_ASYNC_TIMEOUT_MS;
+  i2c_done.store(false, std::memory_order_release);
+  i2c_pending.store(&job, std::memory_order_release);
+  return true;
+}
+
+I2CStatus i2c_backend_poll(I2CJob&) {
+  if (!i2c_done.load(std::memory_order_acquire))
+    return ELAPSED(millis(), deadline_ms) ? I2C_TIMEOUT : I2C_BUSY;
+  i2c_pending.store(nullptr, std::memory_order_release);
+  return I2C_DONE;
+}
+
+void i2c_backend_recover() {
+  i2c_pending.store(nullptr, std::memory_order_release);
+  i2c_done.store(false, std::memory_order_release);
+}
+
+bool i2c_backend_write_now(const uint8_t, const uint8_t * const, const uint8_t) { return true; }
+
+#endif // I2C_ASYNC_QUEUE
+#endif // __PLAT_LINUX__
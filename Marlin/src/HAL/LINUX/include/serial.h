@@ -96,9 +96,27 @@ struct HalSerial {
   bool connected() { return host_connected; }
 
   uint16_t available() {
-    return (uint16_t)receive_buffer.available();
+    const uint16_t n = (uint16_t)receive_buffer.available();
+    TERN_(SERIAL_STATS_MAX_RX_QUEUED, NOLESS(rx_max_enqueued, n));
+    return n;
   }
 
+  // The host thread waits for room, so no byte is ever lost.
+  // The queue depth is taken as it's read.
+  #if ENABLED(SERIAL_STATS_DROPPED_RX)
+    uint32_t dropped() { return 0; }
+  #endif
+  #if ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS)
+    uint32_t buffer_overruns() { return 0; }
+  #endif
+  #if ENABLED(SERIAL_STATS_RX_FRAMING_ERRORS)
+    uint32_t framing_errors() { return 0; }
+  #endif
+  #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
+    uint16_t rxMaxEnqueued() { return rx_max_enqueued; }
+    uint16_t rx_max_enqueued = 0;
+  #endif
+
   void flush() { receive_buffer.clear(); }
 
   uint8_t availableForWrite() {
@@ -29,9 +29,11 @@
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "benchmark.h"
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdlib.h>
 #include <thread>
 #include <iostream>
 #include <fstream>
@@ -49,6 +51,14 @@ void write_serial_thread() {
   }
 }
 
+// The benchmark has no host to talk to
+void discard_serial_thread() {
+  for (;;) {
+    while (usb_serial.transmit_buffer.read() >= 0) { /* nada */ }
+    std::this_thread::yield();
+  }
+}
+
 void read_serial_thread() {
   char buffer[255] = {};
   for (;;) {
@@ -105,9 +115,20 @@ void simulation_loop() {
   }
 }
 
-int main() {
-  std::thread write_serial (write_serial_thread);
-  std::thread read_serial (read_serial_thread);
+int main(int argc, char *argv[]) {
+  // Host-side benchmarks run alone, without the simulation threads
+  if (argc > 1 && !strcmp(argv[1], "--bench-planner"))
+    return planner_benchmark(argc > 2 ? argv[2] : nullptr);
+  if (argc > 1 && !strcmp(argv[1], "--bench-parser"))
+    return parser_benchmark(argc > 2 ? argv[2] : nullptr);
+
+  // The pipeline and command benchmarks run the whole firmware, with G-code from a file
+  const bool bench_commands = argc > 2 && !strcmp(argv[1], "--bench-commands"),
+             bench = bench_commands || (argc > 2 && !strcmp(argv[1], "--bench"));
+
+  std::thread write_serial (bench ? discard_serial_thread : write_serial_thread);
+  std::thread read_serial;
+  if (!bench) read_serial = std::thread(read_serial_thread);
 
   #ifdef MYSERIAL1
     MYSERIAL1.begin(BAUDRATE);
@@ -118,13 +139,24 @@ int main() {
   Clock::setFrequency(F_CPU);
   Clock::setTimeMultiplier(1.0); // some testing at 10x
 
-  HAL_timer_init();
+  if (bench)
+    HAL_timer_init_virtual();
+  else
+    HAL_timer_init();
 
   std::thread simulation (simulation_loop);
 
   DELAY_US(10000);
 
   setup();
+
+  if (bench) {
+    const int result = bench_commands ? command_benchmark(argv[2])
+                     : pipeline_benchmark(argv[2], argc > 3 ? atof(argv[3]) : 1.0f, argc > 4 ? argv[4] : nullptr);
+    fflush(stdout);
+    _Exit(result); // Leave the simulation threads running
+  }
+
   for (;;) {
     loop();
     std::this_thread::yield();
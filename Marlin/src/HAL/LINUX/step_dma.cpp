@@ -0,0 +1,107 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(FTM_STEP_DMA)
+
+/**
+ * Step pattern playback for the simulator.
+ *
+ * Lanes are given to the pins in the order they are mapped. The words are
+ * written to the pins at their own times on the stepper timer clock: as the
+ * host benchmark advances it, and at each position check.
+ */
+
+#include "../shared/step_dma.h"
+#include "hardware/Timer.h"
+
+extern Timer timers[2];
+
+static pin_t lane_pin[STEP_DMA_LANES];
+static uint8_t lanes;
+
+static const step_dma_word_t *buffer;
+static uint16_t words;
+static double ticks_per_word;
+static uint64_t isr_ticks, start_ticks, played;
+static bool running;
+
+// The stepper timer clock now. In virtual time it goes on from the last step_dma_run
+// as the timer counts, so the words keep playing while the stepper ISR runs.
+static uint64_t now_ticks() {
+  return timers[0].isVirtual() ? isr_ticks + timers[0].getCount()
+                               : Clock::nanosToTicks(Clock::nanos(), STEPPER_TIMER_RATE);
+}
+
+static void play(const uint64_t until, void (*at)(const uint64_t tick)) {
+  while (running) {
+    const uint64_t tick = start_ticks + uint64_t(played * ticks_per_word);
+    if (tick > until) break;
+    if (at) at(tick);
+    step_dma_write(buffer[played++ % words]);
+  }
+}
+
+int8_t step_dma_lane(const pin_t pin) {
+  LOOP_L_N(l, lanes) if (lane_pin[l] == pin) return l;
+  if (lanes == STEP_DMA_LANES) return -1;
+  lane_pin[lanes] = pin;
+  return lanes++;
+}
+
+void step_dma_write(const step_dma_word_t word) {
+  LOOP_L_N(l, lanes) {
+    if (TEST(word, l + STEP_DMA_LANES)) WRITE(lane_pin[l], LOW);
+    if (TEST(word, l)) WRITE(lane_pin[l], HIGH);
+  }
+}
+
+void step_dma_start(const step_dma_word_t * const buf, const uint16_t half, const uint32_t rate) {
+  buffer = buf;
+  words = 2 * half;
+  ticks_per_word = double(STEPPER_TIMER_RATE) / rate;
+  start_ticks = now_ticks();
+  played = 0;
+  running = true;
+}
+
+void step_dma_run(const uint64_t until, void (*at)(const uint64_t tick)/*=nullptr*/) {
+  play(until, at);
+  isr_ticks = until;
+}
+
+uint16_t step_dma_position() {
+  play(now_ticks(), nullptr);
+  return words ? played % words : 0;
+}
+
+uint16_t step_dma_stop() {
+  const uint16_t next = step_dma_position();
+  running = false;
+  return next;
+}
+
+#endif // FTM_STEP_DMA
+#endif // __PLAT_LINUX__
@@ -40,6 +40,12 @@ void HAL_timer_init() {
   timers[1].init(1, TEMP_TIMER_RATE, TIMER1_IRQHandler);
 }
 
+// The stepper timer runs on virtual time, driven by the host benchmark
+void HAL_timer_init_virtual() {
+  timers[0].initVirtual(STEPPER_TIMER_RATE);
+  timers[1].init(1, TEMP_TIMER_RATE, TIMER1_IRQHandler);
+}
+
 void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency) {
   timers[timer_num].start(frequency);
 }
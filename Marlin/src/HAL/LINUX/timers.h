@@ -78,6 +78,7 @@ typedef uint32_t hal_timer_t;
 #define HAL_PWM_TIMER_IRQn
 
 void HAL_timer_init();
+void HAL_timer_init_virtual();
 void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency);
 
 void HAL_timer_set_compare(const uint8_t timer_num, const hal_timer_t compare);
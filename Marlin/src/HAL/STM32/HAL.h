@@ -185,6 +185,10 @@ void HAL_SYSTICK_Callback();
 extern volatile uint32_t systick_uptime_millis;
 
 #define HAL_CAN_SET_PWM_FREQ   // This HAL supports PWM Frequency adjustment
+#define HAL_ASYNC_I2C          // This HAL has an interrupt-driven I2C queue backend
+#ifdef STM32F4xx
+  #define HAL_STEP_DMA         // This HAL can play step patterns by timer-paced DMA
+#endif
 
 // ------------------------
 // Class Utilities
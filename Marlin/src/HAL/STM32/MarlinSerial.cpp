@@ -77,14 +77,244 @@
   DECLARE_SERIAL_PORT(LP1)
 #endif
 
+#if ENABLED(SERIAL_DMA)
+
+  /**
+   * The host port receives into a circular DMA buffer and sends from a DMA ring.
+   *
+   * The DMA writes each byte to RX into the core's rx_buff, so the reader takes
+   * the head from the DMA counter and no byte waits on an interrupt. The HAL
+   * reports an idle line, a half or a full buffer, where the Emergency Parser
+   * scans the new bytes and the lost bytes, if any, are counted. A receive
+   * error stops the DMA and the core falls back to one byte at a time, so the
+   * first such byte restarts the DMA. TX bytes go to the core's tx_buff and a
+   * DMA transfer sends each run of them. The buffers must not be in CCM RAM.
+   */
+
+  #define DMA_SERIAL MSERIAL(SERIAL_PORT)
+
+  // DMA units of the USART requests, by reference manual
+  #ifdef STM32F1xx
+    #define _DMA_UNIT(D,N,S) DMA##D##_Channel##N##S
+    typedef DMA_Channel_TypeDef dma_unit_t;
+    #define SERIAL_DMA_NUM 1
+    #if SERIAL_PORT == 1
+      #define SERIAL_DMA_RX  5
+      #define SERIAL_DMA_TX  4
+    #elif SERIAL_PORT == 2
+      #define SERIAL_DMA_RX  6
+      #define SERIAL_DMA_TX  7
+    #else
+      #define SERIAL_DMA_RX  3
+      #define SERIAL_DMA_TX  2
+    #endif
+  #else
+    #define _DMA_UNIT(D,N,S) DMA##D##_Stream##N##S
+    typedef DMA_Stream_TypeDef dma_unit_t;
+    #if SERIAL_PORT == 1 || SERIAL_PORT == 6
+      #define SERIAL_DMA_NUM 2
+      #define SERIAL_DMA_RX  2
+      #define SERIAL_DMA_TX  7
+    #elif SERIAL_PORT == 2
+      #define SERIAL_DMA_NUM 1
+      #define SERIAL_DMA_RX  5
+      #define SERIAL_DMA_TX  6
+    #elif SERIAL_PORT == 3
+      #define SERIAL_DMA_NUM 1
+      #define SERIAL_DMA_RX  1
+      #define SERIAL_DMA_TX  3
+    #elif SERIAL_PORT == 4
+      #define SERIAL_DMA_NUM 1
+      #define SERIAL_DMA_RX  2
+      #define SERIAL_DMA_TX  4
+    #else
+      #define SERIAL_DMA_NUM 1
+      #define SERIAL_DMA_RX  0
+      #define SERIAL_DMA_TX  7
+    #endif
+    #if SERIAL_PORT == 6
+      #define SERIAL_DMA_CHANNEL DMA_CHANNEL_5
+    #else
+      #define SERIAL_DMA_CHANNEL DMA_CHANNEL_4
+    #endif
+  #endif
+  #define DMA_UNIT(D,N,S...) _DMA_UNIT(D,N,S)
+  #define _DMA_CLK_ENABLE(D) __HAL_RCC_DMA##D##_CLK_ENABLE()
+  #define DMA_CLK_ENABLE(D) _DMA_CLK_ENABLE(D)
+
+  #define RX_MASK (SERIAL_RX_BUFFER_SIZE - 1)
+  static_assert(IS_POWER_OF_2(SERIAL_RX_BUFFER_SIZE), "SERIAL_DMA requires a power of 2 RX_BUFFER_SIZE.");
+
+  static DMA_HandleTypeDef dma_rx, dma_tx;
+
+  extern "C" void DMA_UNIT(SERIAL_DMA_NUM, SERIAL_DMA_RX, _IRQHandler)(void) { HAL_DMA_IRQHandler(&dma_rx); }
+  extern "C" void DMA_UNIT(SERIAL_DMA_NUM, SERIAL_DMA_TX, _IRQHandler)(void) { HAL_DMA_IRQHandler(&dma_tx); }
+
+  // Called by the HAL for an idle line, a half buffer and a full buffer
+  extern "C" void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size) {
+    if (huart->hdmarx == &dma_rx) DMA_SERIAL._rx_event_irq(Size);
+  }
+
+  static void dma_init(DMA_HandleTypeDef &hdma, dma_unit_t * const unit, const uint32_t direction, const IRQn_Type irq) {
+    hdma.Instance = unit;
+    #ifndef STM32F1xx
+      hdma.Init.Channel = SERIAL_DMA_CHANNEL;
+      hdma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    #endif
+    hdma.Init.Direction = direction;
+    hdma.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma.Init.MemInc = DMA_MINC_ENABLE;
+    hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma.Init.Mode = direction == DMA_PERIPH_TO_MEMORY ? DMA_CIRCULAR : DMA_NORMAL;
+    hdma.Init.Priority = direction == DMA_PERIPH_TO_MEMORY ? DMA_PRIORITY_HIGH : DMA_PRIORITY_MEDIUM;
+    HAL_DMA_Init(&hdma);
+    HAL_NVIC_SetPriority(irq, UART_IRQ_PRIO, UART_IRQ_SUBPRIO);
+    HAL_NVIC_EnableIRQ(irq);
+  }
+
+  void MarlinSerial::start_rx_dma() {
+    rx_pos = 0;
+    rx_resync = 0;
+    HAL_UARTEx_ReceiveToIdle_DMA(&_serial.handle, _serial.rx_buff, SERIAL_RX_BUFFER_SIZE);
+  }
+
+  // Send the bytes up to the head or the end of the ring. Called with interrupts off.
+  void MarlinSerial::start_tx_dma() {
+    const tx_buffer_index_t head = _serial.tx_head, tail = _serial.tx_tail;
+    if (head == tail) return;
+    tx_length = (head > tail ? head : SERIAL_TX_BUFFER_SIZE) - tail;
+    __HAL_UART_CLEAR_FLAG(&_serial.handle, UART_FLAG_TC); // So flush() waits for the last byte
+    HAL_DMA_Start_IT(&dma_tx, uint32_t(&_serial.tx_buff[tail]), uint32_t(&_serial.uart->DR), tx_length);
+  }
+
+  void MarlinSerial::_tx_complete_irq() {
+    _serial.tx_tail = (_serial.tx_tail + tx_length) % SERIAL_TX_BUFFER_SIZE;
+    tx_length = 0;
+    start_tx_dma();
+  }
+
+  void MarlinSerial::_rx_event_irq(const uint16_t size) {
+    const uint16_t pos = size & RX_MASK, last = rx_pos,
+                   tail = rx_resync >= 0 ? rx_resync : _serial.rx_tail,
+                   fresh = (pos - last) & RX_MASK, queued = (last - tail) & RX_MASK;
+
+    // The DMA went past the reader. Keep the newest bytes.
+    if (queued + fresh > RX_MASK) {
+      TERN_(SERIAL_STATS_DROPPED_RX, rx_dropped_bytes += queued + fresh - RX_MASK);
+      rx_resync = (pos + 1) & RX_MASK;
+    }
+    #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
+      else
+        NOLESS(rx_max_enqueued, queued + fresh);
+    #endif
+
+    #if ENABLED(EMERGENCY_PARSER)
+      for (uint16_t i = last; i != pos; i = (i + 1) & RX_MASK)
+        emergency_parser.update(static_cast<MSerialT*>(this)->emergency_state, _serial.rx_buff[i]);
+    #endif
+
+    rx_pos = pos;
+  }
+
+  int MarlinSerial::available() {
+    if (!_dma) return HardwareSerial::available();
+    if (rx_resync >= 0) {
+      CRITICAL_SECTION_START();
+      _serial.rx_tail = rx_resync;
+      rx_resync = -1;
+      CRITICAL_SECTION_END();
+    }
+    const uint16_t head = (SERIAL_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&dma_rx)) & RX_MASK;
+    return (head - _serial.rx_tail) & RX_MASK;
+  }
+
+  int MarlinSerial::peek() {
+    if (!_dma) return HardwareSerial::peek();
+    return available() ? _serial.rx_buff[_serial.rx_tail] : -1;
+  }
+
+  int MarlinSerial::read() {
+    if (!_dma) return HardwareSerial::read();
+    if (!available()) return -1;
+    const uint8_t c = _serial.rx_buff[_serial.rx_tail];
+    _serial.rx_tail = (_serial.rx_tail + 1) & RX_MASK;
+    return c;
+  }
+
+  size_t MarlinSerial::write(uint8_t c) {
+    if (!_dma) return HardwareSerial::write(c);
+    const tx_buffer_index_t i = (_serial.tx_head + 1) % SERIAL_TX_BUFFER_SIZE;
+    while (i == _serial.tx_tail) { /* The DMA frees a run of bytes */ }
+    _serial.tx_buff[_serial.tx_head] = c;
+    CRITICAL_SECTION_START();
+    _serial.tx_head = i;
+    if (!tx_length) start_tx_dma();
+    CRITICAL_SECTION_END();
+    return 1;
+  }
+
+  size_t MarlinSerial::write(const uint8_t *buffer, size_t size) {
+    if (!_dma) return HardwareSerial::write(buffer, size);
+    for (size_t i = 0; i < size; ++i) write(buffer[i]);
+    return size;
+  }
+
+  void MarlinSerial::flush() {
+    if (!_dma) return HardwareSerial::flush();
+    while (_serial.tx_head != _serial.tx_tail) { /* The DMA sends the rest */ }
+    while (!__HAL_UART_GET_FLAG(&_serial.handle, UART_FLAG_TC)) { /* The last byte goes out */ }
+  }
+
+  void MarlinSerial::end() {
+    if (_dma) {
+      flush();
+      HAL_UART_AbortReceive(&_serial.handle); // Also stops the RX DMA
+      _dma = false;
+    }
+    HardwareSerial::end();
+  }
+
+#endif // SERIAL_DMA
+
 void MarlinSerial::begin(unsigned long baud, uint8_t config) {
   HardwareSerial::begin(baud, config);
   // Replace the IRQ callback with the one we have defined
-  TERN_(EMERGENCY_PARSER, _serial.rx_callback = _rx_callback);
+  #if ANY(EMERGENCY_PARSER, SERIAL_DMA, SERIAL_STATS_DROPPED_RX, SERIAL_STATS_MAX_RX_QUEUED)
+    _serial.rx_callback = _rx_callback;
+  #endif
+
+  #if ENABLED(SERIAL_DMA)
+    _dma = static_cast<MarlinSerial*>(&DMA_SERIAL) == this;
+    if (_dma) {
+      HAL_UART_AbortReceive(&_serial.handle);   // Stop the interrupt per byte
+      DMA_CLK_ENABLE(SERIAL_DMA_NUM);
+      dma_init(dma_rx, DMA_UNIT(SERIAL_DMA_NUM, SERIAL_DMA_RX), DMA_PERIPH_TO_MEMORY, DMA_UNIT(SERIAL_DMA_NUM, SERIAL_DMA_RX, _IRQn));
+      dma_init(dma_tx, DMA_UNIT(SERIAL_DMA_NUM, SERIAL_DMA_TX), DMA_MEMORY_TO_PERIPH, DMA_UNIT(SERIAL_DMA_NUM, SERIAL_DMA_TX, _IRQn));
+      dma_tx.XferCpltCallback = [](DMA_HandleTypeDef*) { DMA_SERIAL._tx_complete_irq(); };
+      __HAL_LINKDMA(&_serial.handle, hdmarx, dma_rx);
+      SET_BIT(_serial.uart->CR3, USART_CR3_DMAT);
+      _serial.rx_tail = 0;
+      _serial.tx_head = _serial.tx_tail = 0;
+      tx_length = 0;
+      start_rx_dma();
+    }
+  #endif
 }
 
 // This function is Copyright (c) 2006 Nicholas Zambetti.
 void MarlinSerial::_rx_complete_irq(serial_t *obj) {
+  #if ENABLED(SERIAL_DMA)
+    // A receive error stopped the DMA and the core went back to one byte at a time.
+    // Restart the DMA. The bytes not yet read are lost with the one in error.
+    if (_dma) {
+      TERN_(SERIAL_STATS_RX_BUFFER_OVERRUNS, rx_buffer_overruns++);
+      TERN_(SERIAL_STATS_DROPPED_RX, rx_dropped_bytes += ((rx_pos - _serial.rx_tail) & RX_MASK) + 1);
+      start_rx_dma();
+      return;
+    }
+  #endif
+
   // No Parity error, read byte and store it in the buffer if there is room
   unsigned char c;
 
@@ -99,7 +329,12 @@ void MarlinSerial::_rx_complete_irq(serial_t *obj) {
     if (i != obj->rx_tail) {
       obj->rx_buff[obj->rx_head] = c;
       obj->rx_head = i;
+      TERN_(SERIAL_STATS_MAX_RX_QUEUED, NOLESS(rx_max_enqueued, (unsigned int)(i - obj->rx_tail) % SERIAL_RX_BUFFER_SIZE));
     }
+    #if ENABLED(SERIAL_STATS_DROPPED_RX)
+      else
+        rx_dropped_bytes++;
+    #endif
 
     #if ENABLED(EMERGENCY_PARSER)
       emergency_parser.update(static_cast<MSerialT*>(this)->emergency_state, c);
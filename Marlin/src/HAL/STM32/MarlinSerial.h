@@ -41,8 +41,52 @@ struct MarlinSerial : public HardwareSerial {
 
   void _rx_complete_irq(serial_t *obj);
 
+  #if ENABLED(SERIAL_DMA)
+    // The host port (SERIAL_PORT) receives and sends by DMA
+    using HardwareSerial::write;
+    void end();
+    int available();
+    int peek();
+    int read();
+    size_t write(uint8_t c);
+    size_t write(const uint8_t *buffer, size_t size);
+    void flush();
+
+    void _rx_event_irq(const uint16_t size);
+    void _tx_complete_irq();
+  #endif
+
+  #if ENABLED(SERIAL_STATS_DROPPED_RX)
+    uint32_t dropped() { return rx_dropped_bytes; }
+  #endif
+  #if ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS)
+    uint32_t buffer_overruns() { return rx_buffer_overruns; }
+  #endif
+  #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
+    uint16_t rxMaxEnqueued() { return rx_max_enqueued; }
+  #endif
+
 protected:
   usart_rx_callback_t _rx_callback;
+
+  #if ENABLED(SERIAL_DMA)
+    bool _dma = false;
+    volatile uint16_t rx_pos = 0,     // Where the last RX event found the DMA
+                      tx_length = 0;  // Bytes in the running TX transfer
+    volatile int32_t rx_resync = -1;  // Next byte to read after bytes were lost, or -1
+    void start_rx_dma();
+    void start_tx_dma();
+  #endif
+
+  #if ENABLED(SERIAL_STATS_DROPPED_RX)
+    volatile uint32_t rx_dropped_bytes = 0;
+  #endif
+  #if ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS)
+    volatile uint32_t rx_buffer_overruns = 0;
+  #endif
+  #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
+    volatile uint16_t rx_max_enqueued = 0;
+  #endif
 };
 
 typedef Serial1Class<MarlinSerial> MSerialT;
@@ -0,0 +1,112 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(I2C_ASYNC_QUEUE)
+
+/**
+ * Interrupt-driven backend for the I2C queue.
+ *
+ * Transfers use the sequential IT API of the STM32 HAL on the I2C handle owned
+ * by Wire, so the I2C event/error IRQs installed by the core move the bytes.
+ * i2c_backend_poll() only checks the handle state and never waits.
+ */
+
+#include "../shared/i2c_async.h"
+#include <Wire.h>
+
+static I2C_HandleTypeDef *hi2c; // = nullptr
+static bool rx_phase;
+static millis_t deadline_ms;
+
+void i2c_backend_init() {
+  Wire.begin(
+    #if PINS_EXIST(I2C_SCL, I2C_SDA)
+      uint8_t(I2C_SDA_PIN), uint8_t(I2C_SCL_PIN)
+    #endif
+  );
+  hi2c = Wire.getHandle();
+}
+
+static bool start_rx(I2CJob &job) {
+  rx_phase = true;
+  deadline_ms = millis() + I2C_ASYNC_TIMEOUT_MS;
+  return HAL_OK == HAL_I2C_Master_Seq_Receive_IT(hi2c, uint16_t(job.address) << 1, job.rx, job.rx_len, I2C_FIRST_AND_LAST_FRAME);
+}
+
+bool i2c_backend_start(I2CJob &job) {
+  if (!hi2c || HAL_I2C_GetState(hi2c) != HAL_I2C_STATE_READY) return false;
+  if (!job.tx_len) return start_rx(job);
+  rx_phase = false;
+  deadline_ms = millis() + I2C_ASYNC_TIMEOUT_MS;
+  return HAL_OK == HAL_I2C_Master_Seq_Transmit_IT(hi2c, uint16_t(job.address) << 1, job.tx, job.tx_len, I2C_FIRST_AND_LAST_FRAME);
+}
+
+I2CStatus i2c_backend_poll(I2CJob &job) {
+  if (HAL_I2C_GetState(hi2c) != HAL_I2C_STATE_READY)
+    return ELAPSED(millis(), deadline_ms) ? I2C_TIMEOUT : I2C_BUSY;
+
+  const uint32_t err = HAL_I2C_GetError(hi2c);
+  if (err & HAL_I2C_ERROR_AF) return I2C_NACK;
+  if (err != HAL_I2C_ERROR_NONE) return I2C_BUS_ERROR;
+
+  // Write done. Read the reply, if any.
+  if (!rx_phase && job.rx_len) return start_rx(job) ? I2C_BUSY : I2C_BUS_ERROR;
+
+  return I2C_DONE;
+}
+
+// Reset the peripheral. This aborts any transfer and clears a BUSY flag left by a glitch.
+void i2c_backend_recover() {
+  if (!hi2c) return;
+  HAL_I2C_DeInit(hi2c);
+  HAL_I2C_Init(hi2c);
+}
+
+/**
+ * Polled write, usable with interrupts off as in minkill(). The IT transfer is
+ * driven by calling the I2C IRQ handlers here, with interrupts held off, and it
+ * is timed with DELAY_US, so neither the I2C IRQs nor SysTick are needed.
+ */
+bool i2c_backend_write_now(const uint8_t address, const uint8_t * const data, const uint8_t len) {
+  if (!hi2c) return false;
+  const bool irqon = !__get_PRIMASK();
+  __disable_irq();
+  if (HAL_I2C_GetState(hi2c) != HAL_I2C_STATE_READY) i2c_backend_recover();
+  bool ok = HAL_OK == HAL_I2C_Master_Seq_Transmit_IT(hi2c, uint16_t(address) << 1, const_cast<uint8_t*>(data), len, I2C_FIRST_AND_LAST_FRAME);
+  for (uint32_t us = I2C_ASYNC_TIMEOUT_MS * 1000UL; ok && HAL_I2C_GetState(hi2c) != HAL_I2C_STATE_READY; --us) {
+    if (!us) { i2c_backend_recover(); ok = false; break; }
+    HAL_I2C_EV_IRQHandler(hi2c);
+    HAL_I2C_ER_IRQHandler(hi2c);
+    DELAY_US(1);
+  }
+  ok = ok && HAL_I2C_GetError(hi2c) == HAL_I2C_ERROR_NONE;
+  if (irqon) __enable_irq();
+  return ok;
+}
+
+#endif // I2C_ASYNC_QUEUE
+#endif // HAL_STM32
@@ -46,12 +46,30 @@
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4 hardware."
 #endif
 
-#if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
-  #error "SERIAL_STATS_MAX_RX_QUEUED is not supported on STM32."
-#elif ENABLED(SERIAL_STATS_DROPPED_RX)
-  #error "SERIAL_STATS_DROPPED_RX is not supported on STM32."
+#if ENABLED(SERIAL_STATS_RX_FRAMING_ERRORS)
+  #error "SERIAL_STATS_RX_FRAMING_ERRORS is not supported on STM32."
+#elif ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS) && DISABLED(SERIAL_DMA)
+  #error "SERIAL_STATS_RX_BUFFER_OVERRUNS requires SERIAL_DMA on STM32."
+#endif
+
+#if ENABLED(SERIAL_DMA)
+  #if NOT_TARGET(STM32F1xx, STM32F4xx)
+    #error "SERIAL_DMA is currently only supported on STM32F1 and STM32F4 hardware."
+  #elif SERIAL_PORT == -1
+    #error "SERIAL_DMA requires a hardware SERIAL_PORT."
+  #elif defined(STM32F1xx) && !WITHIN(SERIAL_PORT, 1, 3)
+    #error "SERIAL_DMA on STM32F1 requires SERIAL_PORT 1, 2 or 3."
+  #endif
 #endif
 
 #if ANY(TFT_COLOR_UI, TFT_LVGL_UI, TFT_CLASSIC_UI) && NOT_TARGET(STM32H7xx, STM32F4xx, STM32F1xx)
   #error "TFT_COLOR_UI, TFT_LVGL_UI and TFT_CLASSIC_UI are currently only supported on STM32H7, STM32F4 and STM32F1 hardware."
 #endif
+
+#if ENABLED(FTM_STEP_DMA)
+  #if FTM_DMA_TIMER != 1 && FTM_DMA_TIMER != 8
+    #error "FTM_DMA_TIMER must be 1 or 8. Only TIM1 and TIM8 can request DMA2 transfers to GPIO."
+  #elif FTM_DMA_TIMER == 8 && !defined(TIM8_BASE)
+    #error "FTM_DMA_TIMER 8 requires an MCU with TIM8. Use FTM_DMA_TIMER 1."
+  #endif
+#endif
@@ -0,0 +1,107 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(FTM_STEP_DMA)
+
+/**
+ * Step pattern playback by DMA on STM32F4.
+ *
+ * The update event of an advanced timer requests a DMA2 transfer of the next
+ * word to the BSRR of the port of the STEP and DIR pins. The stream runs in
+ * circular mode, so it loops over the two halves of the buffer until stopped.
+ * On the F4 only DMA2 can write to the GPIO ports, and only the TIM1 and TIM8
+ * update events go to DMA2. The buffer must not be in CCM RAM.
+ */
+
+#include "../shared/step_dma.h"
+
+#if FTM_DMA_TIMER == 1
+  #define STEP_DMA_TIMER_DEV  TIM1
+  #define STEP_DMA_STREAM     DMA2_Stream5
+  #define STEP_DMA_CHANNEL    DMA_CHANNEL_6
+#else
+  #define STEP_DMA_TIMER_DEV  TIM8
+  #define STEP_DMA_STREAM     DMA2_Stream1
+  #define STEP_DMA_CHANNEL    DMA_CHANNEL_7
+#endif
+
+static GPIO_TypeDef *port = nullptr;
+static HardwareTimer *timer = nullptr;
+static DMA_HandleTypeDef hdma;
+static uint16_t words;
+
+int8_t step_dma_lane(const pin_t pin) {
+  const PinName pin_name = digitalPinToPinName(pin);
+  if (pin_name == NC) return -1;
+  GPIO_TypeDef * const pin_port = get_GPIO_Port(STM_PORT(pin_name));
+  if (!port) port = pin_port;
+  return pin_port == port ? STM_PIN(pin_name) : -1;
+}
+
+void step_dma_write(const step_dma_word_t word) { port->BSRR = word; }
+
+void step_dma_start(const step_dma_word_t * const buffer, const uint16_t half, const uint32_t rate) {
+  if (!timer) {
+    __HAL_RCC_DMA2_CLK_ENABLE();
+    hdma.Instance = STEP_DMA_STREAM;
+    hdma.Init.Channel = STEP_DMA_CHANNEL;
+    hdma.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hdma.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma.Init.MemInc = DMA_MINC_ENABLE;
+    hdma.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+    hdma.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+    hdma.Init.Mode = DMA_CIRCULAR;
+    hdma.Init.Priority = DMA_PRIORITY_VERY_HIGH;
+    hdma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&hdma);
+
+    timer = new HardwareTimer(STEP_DMA_TIMER_DEV);
+    timer->setOverflow(rate, HERTZ_FORMAT);
+  }
+
+  words = 2 * half;
+  timer->pause();
+  timer->setCount(0);
+  HAL_DMA_Start(&hdma, uint32_t(buffer), uint32_t(&port->BSRR), words);
+  __HAL_TIM_ENABLE_DMA(timer->getHandle(), TIM_DMA_UPDATE);
+  timer->resume();
+}
+
+uint16_t step_dma_position() {
+  return (words - __HAL_DMA_GET_COUNTER(&hdma)) % words;
+}
+
+uint16_t step_dma_stop() {
+  timer->pause();                         // No more requests, so the position holds
+  const uint16_t next = step_dma_position();
+  __HAL_TIM_DISABLE_DMA(timer->getHandle(), TIM_DMA_UPDATE);
+  HAL_DMA_Abort(&hdma);
+  return next;
+}
+
+#endif // FTM_STEP_DMA
+#endif // HAL_STM32
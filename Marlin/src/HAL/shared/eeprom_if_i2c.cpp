@@ -31,7 +31,11 @@
 
 #include "eeprom_if.h"
 
-#if ENABLED(SOFT_I2C_EEPROM)
+// Share the hardware bus with the bed ADC and expander through the I2C queue
+#if ENABLED(I2C_ASYNC_QUEUE) && DISABLED(SOFT_I2C_EEPROM)
+  #define EEPROM_I2C_QUEUE 1
+  #include "i2c_async.h"
+#elif ENABLED(SOFT_I2C_EEPROM)
   #include <SlowSoftWire.h>
   SlowSoftWire Wire = SlowSoftWire(I2C_SDA_PIN, I2C_SCL_PIN, true);
 #else
@@ -39,11 +43,15 @@
 #endif
 
 void eeprom_init() {
-  Wire.begin(
-    #if PINS_EXIST(I2C_SCL, I2C_SDA) && DISABLED(SOFT_I2C_EEPROM)
-      uint8_t(I2C_SDA_PIN), uint8_t(I2C_SCL_PIN)
-    #endif
-  );
+  #if EEPROM_I2C_QUEUE
+    // The bus is started by i2c_async.init()
+  #else
+    Wire.begin(
+      #if PINS_EXIST(I2C_SCL, I2C_SDA) && DISABLED(SOFT_I2C_EEPROM)
+        uint8_t(I2C_SDA_PIN), uint8_t(I2C_SCL_PIN)
+      #endif
+    );
+  #endif
 }
 
 #if ENABLED(USE_SHARED_EEPROM)
@@ -73,30 +81,61 @@ static uint8_t _eeprom_calc_device_address(uint8_t * const pos) {
     : eeprom_device_address;
 }
 
-static void _eeprom_begin(uint8_t * const pos) {
-  const unsigned eeprom_address = (unsigned)pos;
-  Wire.beginTransmission(_eeprom_calc_device_address(pos));
-  if (!SMALL_EEPROM)
-    Wire.write(uint8_t((eeprom_address >> 8) & 0xFF));  // Address High, if needed
-  Wire.write(uint8_t(eeprom_address & 0xFF));           // Address Low
-}
+#if EEPROM_I2C_QUEUE
+
+  // Put the memory address into buf and return its length
+  static uint8_t _eeprom_address(uint8_t * const pos, uint8_t * const buf) {
+    const unsigned eeprom_address = (unsigned)pos;
+    uint8_t n = 0;
+    if (!SMALL_EEPROM) buf[n++] = uint8_t((eeprom_address >> 8) & 0xFF); // Address High, if needed
+    buf[n++] = uint8_t(eeprom_address & 0xFF);                          // Address Low
+    return n;
+  }
+
+  void eeprom_write_byte(uint8_t *pos, uint8_t value) {
+    uint8_t buf[3];
+    const uint8_t n = _eeprom_address(pos, buf);
+    buf[n] = value;
+    i2c_async.run(_eeprom_calc_device_address(pos), buf, n + 1);
+
+    // wait for write cycle to complete
+    delay(EEPROM_WRITE_DELAY);
+  }
+
+  uint8_t eeprom_read_byte(uint8_t *pos) {
+    uint8_t buf[2], value;
+    const uint8_t n = _eeprom_address(pos, buf);
+    return i2c_async.run(_eeprom_calc_device_address(pos), buf, n, &value, 1) == I2C_DONE ? value : 0xFF;
+  }
 
-void eeprom_write_byte(uint8_t *pos, uint8_t value) {
-  _eeprom_begin(pos);
-  Wire.write(value);
-  Wire.endTransmission();
+#else
 
-  // wait for write cycle to complete
-  // this could be done more efficiently with "acknowledge polling"
-  delay(EEPROM_WRITE_DELAY);
-}
+  static void _eeprom_begin(uint8_t * const pos) {
+    const unsigned eeprom_address = (unsigned)pos;
+    Wire.beginTransmission(_eeprom_calc_device_address(pos));
+    if (!SMALL_EEPROM)
+      Wire.write(uint8_t((eeprom_address >> 8) & 0xFF));  // Address High, if needed
+    Wire.write(uint8_t(eeprom_address & 0xFF));           // Address Low
+  }
+
+  void eeprom_write_byte(uint8_t *pos, uint8_t value) {
+    _eeprom_begin(pos);
+    Wire.write(value);
+    Wire.endTransmission();
+
+    // wait for write cycle to complete
+    // this could be done more efficiently with "acknowledge polling"
+    delay(EEPROM_WRITE_DELAY);
+  }
+
+  uint8_t eeprom_read_byte(uint8_t *pos) {
+    _eeprom_begin(pos);
+    Wire.endTransmission();
+    Wire.requestFrom(_eeprom_calc_device_address(pos), (byte)1);
+    return Wire.available() ? Wire.read() : 0xFF;
+  }
 
-uint8_t eeprom_read_byte(uint8_t *pos) {
-  _eeprom_begin(pos);
-  Wire.endTransmission();
-  Wire.requestFrom(_eeprom_calc_device_address(pos), (byte)1);
-  return Wire.available() ? Wire.read() : 0xFF;
-}
+#endif
 
 #endif // USE_SHARED_EEPROM
 #endif // I2C_EEPROM
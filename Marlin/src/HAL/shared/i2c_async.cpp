@@ -0,0 +1,247 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * HAL/shared/i2c_async.cpp - Asynchronous I2C transaction queue
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(I2C_ASYNC_QUEUE)
+
+#include "i2c_async.h"
+
+I2CAsync i2c_async;
+
+I2CJob I2CAsync::jobs[I2C_ASYNC_QUEUE_SIZE];
+I2CJob *I2CAsync::active; // = nullptr
+uint16_t I2CAsync::next_seq; // = 0
+I2CAsync::stats_t I2CAsync::stats;
+
+static bool i2c_ready; // = false
+
+void I2CAsync::init() {
+  i2c_backend_init();
+  i2c_ready = true;
+  reset_stats();
+}
+
+bool I2CAsync::enqueue(const uint8_t address, const uint8_t * const tx, const uint8_t tx_len, const uint8_t rx_len,
+                       const I2CPriority priority/*=I2C_PRIO_NORMAL*/, const i2c_callback_t callback/*=nullptr*/, const uintptr_t tag/*=0*/
+) {
+  if (tx_len > I2C_JOB_MAX_TX || rx_len > I2C_JOB_MAX_RX || !(tx_len || rx_len)) return false;
+
+  I2CJob *job = nullptr;
+  CRITICAL_SECTION_START();
+    LOOP_L_N(i, I2C_ASYNC_QUEUE_SIZE) if (jobs[i].status == I2C_FREE) { job = &jobs[i]; break; }
+    if (job) {
+      job->address = address;
+      job->tx_len = tx_len;
+      job->rx_len = rx_len;
+      LOOP_L_N(i, tx_len) job->tx[i] = tx[i];
+      job->priority = priority;
+      job->retries = 0;
+      job->seq = next_seq++;
+      job->callback = callback;
+      job->tag = tag;
+      job->queued_us = micros();
+      job->status = I2C_QUEUED;
+      NOLESS(stats.depth_max, depth());
+    }
+    else
+      stats.dropped++;
+  CRITICAL_SECTION_END();
+
+  return job != nullptr;
+}
+
+uint8_t I2CAsync::depth() {
+  uint8_t n = 0;
+  LOOP_L_N(i, I2C_ASYNC_QUEUE_SIZE) if (jobs[i].status == I2C_QUEUED) n++;
+  return n;
+}
+
+// The queued job with the highest priority, oldest first
+I2CJob* I2CAsync::next_job() {
+  I2CJob *best = nullptr;
+  CRITICAL_SECTION_START();
+    LOOP_L_N(i, I2C_ASYNC_QUEUE_SIZE) {
+      I2CJob &j = jobs[i];
+      if (j.status != I2C_QUEUED) continue;
+      if (!best || j.priority < best->priority || (j.priority == best->priority && int16_t(j.seq - best->seq) < 0))
+        best = &j;
+    }
+  CRITICAL_SECTION_END();
+  return best;
+}
+
+// Free the slot before the callback so the callback can queue a follow-up job
+void I2CAsync::finish(I2CJob &job, const I2CStatus status) {
+  job.status = status;
+  const I2CJob done = job;
+  job.status = I2C_FREE;
+  stats.jobs++;
+  if (done.callback) done.callback(done);
+}
+
+void I2CAsync::task() {
+  if (!i2c_ready) return;
+
+  if (active) {
+    I2CJob &job = *active;
+    const I2CStatus status = job.status == I2C_BUSY ? i2c_backend_poll(job) : job.status;
+    if (status == I2C_BUSY) return;
+
+    stats.busy_us += micros() - job.started_us;
+    active = nullptr;
+
+    switch (status) {
+      case I2C_NACK: stats.nacks++; break;
+      case I2C_BUS_ERROR: case I2C_TIMEOUT:
+        if (status == I2C_TIMEOUT) stats.timeouts++; else stats.bus_errors++;
+        // Free the bus and try again. The job keeps its place in the queue.
+        stats.recoveries++;
+        i2c_backend_recover();
+        if (job.retries++ < I2C_ASYNC_RETRIES) { job.status = I2C_QUEUED; return; }
+        break;
+      default: break;
+    }
+    finish(job, status);
+  }
+
+  I2CJob * const job = next_job();
+  if (!job) return;
+
+  const uint32_t now = micros();
+  if (!job->retries) {
+    const uint32_t wait = now - job->queued_us;
+    stats.started++;
+    stats.wait_us += wait;
+    NOLESS(stats.wait_max_us, wait);
+  }
+  job->started_us = now;
+  job->status = I2C_BUSY;
+  active = job;
+  if (!i2c_backend_start(*job)) job->status = I2C_BUS_ERROR; // Handled on the next call
+}
+
+struct i2c_run_t { volatile I2CStatus status; uint8_t *rx; };
+
+static void i2c_run_done(const I2CJob &job) {
+  i2c_run_t * const r = (i2c_run_t*)job.tag;
+  if (r->rx) LOOP_L_N(i, job.rx_len) r->rx[i] = job.rx[i];
+  r->status = job.status;
+}
+
+I2CStatus I2CAsync::run(const uint8_t address, const uint8_t * const tx, const uint8_t tx_len,
+                        uint8_t * const rx/*=nullptr*/, const uint8_t rx_len/*=0*/
+) {
+  if (!i2c_ready) return I2C_BUS_ERROR;
+  i2c_run_t r = { I2C_QUEUED, rx };
+  if (!enqueue(address, tx, tx_len, rx_len, I2C_PRIO_HIGH, i2c_run_done, uintptr_t(&r))) return I2C_BUS_ERROR;
+  // Every job ends within its timeout and retries, so this loop is bounded
+  while (r.status == I2C_QUEUED) task();
+  return r.status;
+}
+
+bool I2CAsync::write_now(const uint8_t address, const uint8_t * const data, const uint8_t len) {
+  if (!i2c_ready) return false;
+  CRITICAL_SECTION_START();
+    // Abort the transfer in progress. A transfer to another device goes back in the queue.
+    if (active) {
+      i2c_backend_recover();
+      active->status = active->address == address ? I2C_FREE : I2C_QUEUED;
+      active = nullptr;
+    }
+    // Drop the older jobs for this device, so none of them lands after this write
+    LOOP_L_N(i, I2C_ASYNC_QUEUE_SIZE)
+      if (jobs[i].status == I2C_QUEUED && jobs[i].address == address) jobs[i].status = I2C_FREE;
+  CRITICAL_SECTION_END();
+  return i2c_backend_write_now(address, data, len);
+}
+
+void I2CAsync::reset_stats() {
+  stats = {};
+  stats.since_ms = millis();
+}
+
+void I2CAsync::report() {
+  const millis_t window_ms = millis() - stats.since_ms;
+  SERIAL_ECHO_MSG("I2C jobs:", stats.jobs, " queued:", depth(), " max queued:", stats.depth_max, " dropped:", stats.dropped);
+  SERIAL_ECHO_MSG("I2C NACK:", stats.nacks, " bus errors:", stats.bus_errors, " timeouts:", stats.timeouts, " recoveries:", stats.recoveries);
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("I2C bus use:");
+  SERIAL_ECHO_F(window_ms ? stats.busy_us * 0.1f / window_ms : 0.0f, 2);
+  SERIAL_ECHOLNPGM("% latency avg:", stats.started ? stats.wait_us / stats.started : 0, "us max:", stats.wait_max_us, "us");
+}
+
+#ifndef HAL_ASYNC_I2C
+
+  /**
+   * Wire-based backend for HALs without an asynchronous I2C driver.
+   * The transfer runs inside i2c_backend_start(), from I2CAsync::task().
+   */
+
+  #include <Wire.h>
+
+  static I2CStatus wire_transfer(const uint8_t address, const uint8_t * const tx, const uint8_t tx_len, uint8_t * const rx, const uint8_t rx_len) {
+    if (tx_len) {
+      Wire.beginTransmission(address);
+      Wire.write(tx, tx_len);
+      switch (Wire.endTransmission()) {
+        case 0: break;
+        case 2: case 3: return I2C_NACK;
+        case 5: return I2C_TIMEOUT;
+        default: return I2C_BUS_ERROR;
+      }
+    }
+    if (rx_len) {
+      if (Wire.requestFrom(address, rx_len) != rx_len) return I2C_NACK;
+      LOOP_L_N(i, rx_len) rx[i] = Wire.read();
+    }
+    return I2C_DONE;
+  }
+
+  void i2c_backend_init() {
+    Wire.begin(
+      #if PINS_EXIST(I2C_SCL, I2C_SDA)
+        uint8_t(I2C_SDA_PIN), uint8_t(I2C_SCL_PIN)
+      #endif
+    );
+  }
+
+  bool i2c_backend_start(I2CJob &job) {
+    job.status = wire_transfer(job.address, job.tx, job.tx_len, job.rx, job.rx_len);
+    return true;
+  }
+
+  I2CStatus i2c_backend_poll(I2CJob &job) { return job.status; }
+
+  void i2c_backend_recover() { Wire.begin(); }
+
+  bool i2c_backend_write_now(const uint8_t address, const uint8_t * const data, const uint8_t len) {
+    return wire_transfer(address, data, len, nullptr, 0) == I2C_DONE;
+  }
+
+#endif // !HAL_ASYNC_I2C
+
+#endif // I2C_ASYNC_QUEUE
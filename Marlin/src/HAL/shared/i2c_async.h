@@ -0,0 +1,144 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * HAL/shared/i2c_async.h
+ *
+ * Asynchronous I2C transaction queue shared by all devices on the Wire bus.
+ *
+ * A job is a short write, read, or write followed by a read. Jobs may be queued
+ * from any context, including ISRs. I2CAsync::task() runs from the main loop,
+ * starts the highest-priority job, polls the HAL backend for its completion,
+ * and calls the job's callback, so no caller waits on the bus.
+ *
+ * A HAL with a native backend (interrupt driven, threaded, etc.) defines
+ * HAL_ASYNC_I2C and implements the i2c_backend_* functions. Other HALs use
+ * the Wire-based backend in i2c_async.cpp, which does each transfer inside
+ * i2c_backend_start().
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#ifndef I2C_ASYNC_QUEUE_SIZE
+  #define I2C_ASYNC_QUEUE_SIZE 8
+#endif
+#ifndef I2C_ASYNC_TIMEOUT_MS
+  #define I2C_ASYNC_TIMEOUT_MS 10
+#endif
+#ifndef I2C_ASYNC_RETRIES
+  #define I2C_ASYNC_RETRIES    2
+#endif
+
+#define I2C_JOB_MAX_TX 4
+#define I2C_JOB_MAX_RX 4
+
+enum I2CPriority : uint8_t { I2C_PRIO_HIGH, I2C_PRIO_NORMAL, I2C_PRIO_LOW };
+
+enum I2CStatus : uint8_t {
+  I2C_FREE,       // Slot not in use
+  I2C_QUEUED,     // Waiting for the bus
+  I2C_BUSY,       // Transfer in progress
+  I2C_DONE,       // Completed with ACK
+  I2C_NACK,       // Device did not acknowledge
+  I2C_BUS_ERROR,  // Arbitration lost, bus error, etc.
+  I2C_TIMEOUT     // Transfer did not finish within I2C_ASYNC_TIMEOUT_MS
+};
+
+struct I2CJob;
+typedef void (*i2c_callback_t)(const I2CJob &job);
+
+struct I2CJob {
+  uint8_t address;                  // 7-bit device address
+  uint8_t tx_len, rx_len;
+  uint8_t tx[I2C_JOB_MAX_TX], rx[I2C_JOB_MAX_RX];
+  I2CPriority priority;
+  volatile I2CStatus status;
+  uint8_t retries;
+  uint16_t seq;                     // Queue order within a priority
+  i2c_callback_t callback;
+  uintptr_t tag;                    // Caller data for the callback
+  uint32_t queued_us, started_us;
+
+  bool ok() const { return status == I2C_DONE; }
+};
+
+// HAL backend
+void i2c_backend_init();
+bool i2c_backend_start(I2CJob &job);    // Begin a transfer. Return false if it could not start.
+I2CStatus i2c_backend_poll(I2CJob &job);  // I2C_BUSY until the transfer ends, then its result
+void i2c_backend_recover();             // Abort any transfer and free a stuck bus
+bool i2c_backend_write_now(const uint8_t address, const uint8_t * const data, const uint8_t len);
+
+class I2CAsync {
+public:
+  typedef struct {
+    uint32_t jobs, started, nacks, bus_errors, timeouts, recoveries, dropped;
+    uint32_t busy_us,               // Time the bus spent on transfers
+             wait_us,               // Total queue latency of started jobs
+             wait_max_us;           // Worst queue latency
+    millis_t since_ms;              // Start of the statistics window
+    uint8_t depth_max;              // Most jobs queued at once
+  } stats_t;
+
+  static stats_t stats;
+
+  static void init();
+
+  // Queue a job. Return false if the queue is full.
+  static bool enqueue(const uint8_t address, const uint8_t * const tx, const uint8_t tx_len, const uint8_t rx_len,
+                      const I2CPriority priority=I2C_PRIO_NORMAL, const i2c_callback_t callback=nullptr, const uintptr_t tag=0);
+
+  static bool write(const uint8_t address, const uint8_t * const tx, const uint8_t tx_len,
+                    const I2CPriority priority=I2C_PRIO_NORMAL, const i2c_callback_t callback=nullptr, const uintptr_t tag=0) {
+    return enqueue(address, tx, tx_len, 0, priority, callback, tag);
+  }
+
+  // Queue a job and run the queue until it is done. For setup and EEPROM access only.
+  static I2CStatus run(const uint8_t address, const uint8_t * const tx, const uint8_t tx_len,
+                       uint8_t * const rx=nullptr, const uint8_t rx_len=0);
+
+  // Abort the transfer in progress and write right away. Jobs for the same device,
+  // including the aborted one, are dropped without their callbacks, so the caller
+  // must reset any state waiting on them. A job for another device is queued again.
+  // For shutting heaters off from kill() and error handlers.
+  static bool write_now(const uint8_t address, const uint8_t * const data, const uint8_t len);
+
+  // Advance the queue. Call often from the main loop.
+  static void task();
+
+  static uint8_t depth();
+  static bool idle() { return !active && !depth(); }
+
+  static void reset_stats();
+  static void report();
+
+private:
+  static I2CJob jobs[I2C_ASYNC_QUEUE_SIZE];
+  static I2CJob *active;
+  static uint16_t next_seq;
+
+  static I2CJob* next_job();
+  static void finish(I2CJob &job, const I2CStatus status);
+};
+
+extern I2CAsync i2c_async;
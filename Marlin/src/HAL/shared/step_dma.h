@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * HAL/shared/step_dma.h
+ *
+ * Timer-paced DMA output of STEP and DIR patterns for Fixed-Time Motion.
+ *
+ * The pins are mapped to lanes, the bits of one GPIO port. A pattern word sets
+ * the lanes in its low half and clears the lanes in its high half, like the
+ * STM32 BSRR register. The backend plays a buffer of two halves in a loop at a
+ * fixed word rate, so the stepper only has to refill the half just played.
+ *
+ * A HAL with a backend defines HAL_STEP_DMA and implements these functions.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+typedef uint32_t step_dma_word_t;
+
+#define STEP_DMA_LANES 16
+#define STEP_DMA_SET(L)   step_dma_word_t(_BV32(L))
+#define STEP_DMA_CLEAR(L) step_dma_word_t(_BV32((L) + (STEP_DMA_LANES)))
+
+// Get the lane of a pin, or -1 if it can't share the port of the pins mapped so far
+int8_t step_dma_lane(const pin_t pin);
+
+// Play the 2 * half words of the buffer in a loop, at the given words per second
+void step_dma_start(const step_dma_word_t * const buffer, const uint16_t half, const uint32_t rate);
+
+// Stop and get the index of the next word that would have played
+uint16_t step_dma_stop();
+
+// Get the index of the next word to play
+uint16_t step_dma_position();
+
+// Write a word to the port right away
+void step_dma_write(const step_dma_word_t word);
+
+#ifdef __PLAT_LINUX__
+  // Play the words due up to the given stepper timer tick. The host benchmark
+  // advances the clock and gets the tick of each word before it is written.
+  void step_dma_run(const uint64_t until, void (*at)(const uint64_t tick)=nullptr);
+#endif
@@ -34,6 +34,10 @@
 #include "HAL/shared/esp_wifi.h"
 #include "HAL/shared/cpu_exception/exception_hook.h"
 
+#if ENABLED(I2C_ASYNC_QUEUE)
+  #include "HAL/shared/i2c_async.h"
+#endif
+
 #ifdef ARDUINO
   #include <pins_arduino.h>
 #endif
@@ -170,6 +174,10 @@
   #include "module/scara.h"
 #endif
 
+#if ENABLED(FT_MOTION)
+  #include "module/ft_motion.h"
+#endif
+
 #if HAS_LEVELING
   #include "feature/bedlevel/bedlevel.h"
 #endif
@@ -186,6 +194,14 @@
   #include "feature/cancel_object.h"
 #endif
 
+#if ENABLED(BED_TELEMETRY)
+  #include "feature/bed_telemetry.h"
+#endif
+
+#if BOTH(BED_ZONE_FOOTPRINT, SDSUPPORT)
+  #include "feature/bed_footprint.h"
+#endif
+
 #if HAS_FILAMENT_SENSOR
   #include "feature/runout.h"
 #endif
@@ -781,6 +797,17 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Core Marlin activities
   manage_inactivity(no_stepper_sleep);
 
+  // Queue a held move when the planner needs it, or the next move is slow to come
+  #if HAS_HELD_MOVE
+    if (planner.has_held_move() && planner.held_move_due()) planner.release_held_move();
+  #endif
+
+  // Compute the Fixed-Time Motion frames
+  TERN_(FT_MOTION, ftMotion.loop());
+
+  // Start and complete queued I2C transfers
+  TERN_(I2C_ASYNC_QUEUE, i2c_async.task());
+
   // Manage Heaters (and Watchdog)
   thermalManager.task();
 
@@ -819,6 +846,11 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Handle SD Card insert / remove
   TERN_(SDSUPPORT, card.manage_media());
 
+  // Scan the selected SD file for the bed zones it uses
+  #if BOTH(BED_ZONE_FOOTPRINT, SDSUPPORT)
+    bedfootprint.prescan_task();
+  #endif
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
@@ -852,6 +884,7 @@ void idle(bool no_stepper_sleep/*=false*/) {
   #if HAS_AUTO_REPORTING
     if (!gcode.autoreport_paused) {
       TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
+      TERN_(BED_TELEMETRY, bedtelemetry.tick());
       TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
       TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
@@ -1313,6 +1346,10 @@ void setup() {
     #endif
   #endif
 
+  #if ENABLED(I2C_ASYNC_QUEUE)
+    SETUP_RUN(i2c_async.init());      // Shared I2C bus, before EEPROM and heater expanders
+  #endif
+
   #if BOTH(SDSUPPORT, SDCARD_EEPROM_EMULATION)
     SETUP_RUN(card.mount());          // Mount media with settings before first_load
   #endif
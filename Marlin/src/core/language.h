@@ -124,6 +124,10 @@
 #define STR_BEGIN_FILE_LIST                 "Begin file list"
 #define STR_END_FILE_LIST                   "End file list"
 #define STR_INVALID_EXTRUDER                "Invalid extruder"
+#define STR_INVALID_BED_ZONE                "Invalid bed zone"
+#define STR_ERR_M196_BOUNDS                 "M196 needs X<min> Y<min> I<max> J<max>"
+#define STR_ERR_ADS1115_RATE                "ADS1115 rate must be 8, 16, 32, 64, 128, 250, 475 or 860"
+#define STR_ERR_ADS1115_SWEEP               "ADS1115 sweep too slow for ADS1115_STALE_MS"
 #define STR_INVALID_E_STEPPER               "Invalid E stepper"
 #define STR_E_STEPPER_NOT_SPECIFIED         "E stepper not specified"
 #define STR_INVALID_SOLENOID                "Invalid solenoid"
@@ -295,6 +299,8 @@
 #define STR_SERVO_ANGLES                    "Servo Angles"
 #define STR_HOTEND_PID                      "Hotend PID"
 #define STR_BED_PID                         "Bed PID"
+#define STR_BED_ZONE_COUPLING               "Bed zone coupling"
+#define STR_BED_ADC                         "Bed ADC"
 #define STR_CHAMBER_PID                     "Chamber PID"
 #define STR_STEPS_PER_UNIT                  "Steps per unit"
 #define STR_LINEAR_ADVANCE                  "Linear Advance"
@@ -741,3 +741,8 @@ struct XYZEval {
 #undef _LS
 #undef _RS
 #undef FI
+
+#if HAS_SHAPING
+  // Input shaper types, from the shortest to the most robust
+  enum ShaperType : uint8_t { SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV, SHAPER_EI };
+#endif
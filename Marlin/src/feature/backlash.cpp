@@ -113,7 +113,7 @@ void Backlash::add_correction_steps(const int32_t &da, const int32_t &db, const
       #ifdef BACKLASH_SMOOTHING_MM
         if (error_correction && smoothing_mm != 0) {
           // Take up a portion of the residual_error in this segment
-          if (segment_proportion == 0) segment_proportion = _MIN(1.0f, block->millimeters / smoothing_mm);
+          if (segment_proportion == 0) segment_proportion = _MIN(1.0f, planner.block_millimeters(block) / smoothing_mm);
           error_correction = CEIL(segment_proportion * error_correction);
         }
       #endif
@@ -0,0 +1,269 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BED_ZONE_FOOTPRINT)
+
+#include "bed_footprint.h"
+#include "../MarlinCore.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+BedFootprint bedfootprint;
+
+#define BED_ZONE_ALL (_BV(BED_COUNT) - 1)
+
+uint8_t BedFootprint::zone_mask = BED_ZONE_ALL;
+bool BedFootprint::valid; // = false
+xy_pos_t BedFootprint::fmin, BedFootprint::fmax;
+
+void BedFootprint::reset() {
+  valid = false;
+  zone_mask = BED_ZONE_ALL;
+}
+
+void BedFootprint::include(const xy_pos_t &lo, const xy_pos_t &hi) {
+  if (valid) {
+    NOMORE(fmin.x, lo.x); NOMORE(fmin.y, lo.y);
+    NOLESS(fmax.x, hi.x); NOLESS(fmax.y, hi.y);
+  }
+  else {
+    fmin = lo; fmax = hi;
+    valid = true;
+  }
+  update_mask();
+}
+
+/**
+ * Zones form a BED_ZONE_GRID_X x BED_ZONE_GRID_Y grid over the bed,
+ * numbered from the X/Y minimum corner along X, then along Y.
+ * A zone is active if it overlaps the footprint grown by BED_ZONE_MARGIN.
+ */
+void BedFootprint::update_mask() {
+  constexpr float zw = float(X_BED_SIZE) / (BED_ZONE_GRID_X),
+                  zh = float(Y_BED_SIZE) / (BED_ZONE_GRID_Y);
+
+  const float x1 = fmin.x - (BED_ZONE_MARGIN), x2 = fmax.x + (BED_ZONE_MARGIN),
+              y1 = fmin.y - (BED_ZONE_MARGIN), y2 = fmax.y + (BED_ZONE_MARGIN);
+
+  zone_mask = 0;
+  LOOP_L_N(b, BED_COUNT) {
+    const float zx = (X_MIN_BED) + (b % (BED_ZONE_GRID_X)) * zw,
+                zy = (Y_MIN_BED) + (b / (BED_ZONE_GRID_X)) * zh;
+    if (x1 < zx + zw && x2 > zx && y1 < zy + zh && y2 > zy) SBI(zone_mask, b);
+  }
+
+  // A footprint entirely off the bed is probably wrong. Heat everything.
+  if (!zone_mask) zone_mask = BED_ZONE_ALL;
+}
+
+#if ENABLED(SDSUPPORT)
+
+  #define PRESCAN_LINE_LEN  96
+  #define PRESCAN_MS         5    // Longest scan per idle() call
+
+  bool BedFootprint::scanning; // = false
+
+  // State of the scan, kept between calls
+  static struct {
+    uint32_t index, size;           // Next byte to read, size of the file scanned
+    xy_pos_t pos, lo, hi, hdr_lo, hdr_hi;
+    float e;
+    bool found, rel_xy, rel_e;
+    uint8_t hdr_seen, len;
+    char line[PRESCAN_LINE_LEN];
+  } scan;
+
+  // Get the number after a parameter letter in a comment-stripped line
+  static bool prescan_value(const char *args, const char letter, float &value) {
+    for (const char *p = args; *p; ++p) if (*p == letter) {
+      char *end;
+      value = strtof(p + 1, &end);
+      return end != p + 1;
+    }
+    return false;
+  }
+
+  /**
+   * Take the extents of one line. Slicers that write ;MINX: ;MINY: ;MAXX: ;MAXY:
+   * in the header (e.g., Cura) end the scan early. Return true when done.
+   */
+  static bool prescan_line(char * const line) {
+    // Slicer header bounds
+    if (line[0] == ';') {
+      float v;
+      if (strncmp_P(line, PSTR(";MINX:"), 6) == 0) { v = strtof(line + 6, nullptr); scan.hdr_lo.x = v; SBI(scan.hdr_seen, 0); }
+      else if (strncmp_P(line, PSTR(";MINY:"), 6) == 0) { v = strtof(line + 6, nullptr); scan.hdr_lo.y = v; SBI(scan.hdr_seen, 1); }
+      else if (strncmp_P(line, PSTR(";MAXX:"), 6) == 0) { v = strtof(line + 6, nullptr); scan.hdr_hi.x = v; SBI(scan.hdr_seen, 2); }
+      else if (strncmp_P(line, PSTR(";MAXY:"), 6) == 0) { v = strtof(line + 6, nullptr); scan.hdr_hi.y = v; SBI(scan.hdr_seen, 3); }
+      if (scan.hdr_seen == 0x0F) { scan.lo = scan.hdr_lo; scan.hi = scan.hdr_hi; scan.found = true; return true; }
+      return false;
+    }
+
+    char *p = strchr(line, ';');
+    if (p) *p = '\0';
+    p = line;
+    while (*p == ' ') ++p;
+    if (*p == 'N') { while (*p && *p != ' ') ++p; while (*p == ' ') ++p; }
+
+    const char cmd = *p;
+    if (cmd != 'G' && cmd != 'M') return false;
+    const int code = atoi(++p);
+    while (NUMERIC(*p)) ++p;
+
+    if (cmd == 'M') {
+      if (code == 82) scan.rel_e = false;
+      else if (code == 83) scan.rel_e = true;
+      return false;
+    }
+
+    xy_pos_t &pos = scan.pos;
+    float v;
+    switch (code) {
+      case 0: case 1: case 2: case 3: {
+        xy_pos_t dest = pos;
+        if (prescan_value(p, 'X', v)) dest.x = scan.rel_xy ? pos.x + v : v;
+        if (prescan_value(p, 'Y', v)) dest.y = scan.rel_xy ? pos.y + v : v;
+
+        bool extruding = false;
+        if (prescan_value(p, 'E', v)) {
+          extruding = scan.rel_e ? v > 0 : v > scan.e;
+          scan.e = scan.rel_e ? scan.e + v : v;
+        }
+
+        if (extruding) {
+          xy_pos_t mlo = pos, mhi = pos;
+          NOMORE(mlo.x, dest.x); NOMORE(mlo.y, dest.y);
+          NOLESS(mhi.x, dest.x); NOLESS(mhi.y, dest.y);
+          if (code >= 2) {
+            // Bound an I/J arc by its whole circle
+            xy_pos_t ij{0};
+            const bool has_i = prescan_value(p, 'I', ij.x), has_j = prescan_value(p, 'J', ij.y);
+            if (has_i || has_j) {
+              const xy_pos_t ctr = pos + ij;
+              const float r = HYPOT(ij.x, ij.y);
+              mlo.set(ctr.x - r, ctr.y - r);
+              mhi.set(ctr.x + r, ctr.y + r);
+            }
+          }
+          if (scan.found) {
+            NOMORE(scan.lo.x, mlo.x); NOMORE(scan.lo.y, mlo.y);
+            NOLESS(scan.hi.x, mhi.x); NOLESS(scan.hi.y, mhi.y);
+          }
+          else {
+            scan.lo = mlo; scan.hi = mhi;
+            scan.found = true;
+          }
+        }
+        pos = dest;
+      } break;
+
+      case 90: scan.rel_xy = scan.rel_e = false; break;
+      case 91: scan.rel_xy = scan.rel_e = true; break;
+
+      case 92:
+        if (prescan_value(p, 'X', v)) pos.x = v;
+        if (prescan_value(p, 'Y', v)) pos.y = v;
+        if (prescan_value(p, 'E', v)) scan.e = v;
+        break;
+    }
+    return false;
+  }
+
+  /**
+   * Start finding the XY extents of all extruding moves in the open SD file.
+   * All zones stay active until the scan is done.
+   */
+  void BedFootprint::prescan() {
+    reset();
+    scanning = card.isFileOpen();
+    if (!scanning) return;
+    SERIAL_ECHOLNPGM("Scanning print footprint...");
+    scan = {};
+    scan.size = card.getFileSize();
+  }
+
+  /**
+   * Scan the next part of the file, called from idle(). The print may be
+   * reading the same file already, so its position is put back.
+   */
+  void BedFootprint::prescan_task() {
+    if (!scanning) return;
+
+    // Give up if the file was closed or another was opened
+    if (!card.isFileOpen() || card.getFileSize() != scan.size) { scanning = false; return; }
+
+    const uint32_t print_index = card.getIndex();
+    card.setIndex(scan.index);
+
+    const millis_t end_ms = millis() + PRESCAN_MS;
+    bool done = false;
+    do {
+      char buf[64];
+      const int16_t n = card.read(buf, sizeof(buf));
+      if (n <= 0) { done = true; break; }
+      scan.index += n;
+
+      for (int16_t i = 0; i < n && !done; ++i) {
+        const char c = buf[i];
+        if (c != '\n' && c != '\r') {
+          if (scan.len < PRESCAN_LINE_LEN - 1) scan.line[scan.len++] = (c >= 'a' && c <= 'z') ? c - ('a' - 'A') : c;
+          continue;
+        }
+        if (!scan.len) continue;
+        scan.line[scan.len] = '\0';
+        scan.len = 0;
+        done = prescan_line(scan.line);
+      }
+    } while (!done && PENDING(millis(), end_ms));
+
+    card.setIndex(print_index);
+
+    if (done) {
+      scanning = false;
+      if (scan.found) set(scan.lo, scan.hi);
+      report();
+    }
+  }
+
+  // Wait for the scan to be done, for a command that needs the zones
+  void BedFootprint::finish_prescan() {
+    while (scanning) idle();
+  }
+
+#endif // SDSUPPORT
+
+void BedFootprint::report() {
+  SERIAL_ECHO_START();
+  if (valid)
+    SERIAL_ECHOPGM("Footprint X", fmin.x, ":", fmax.x, " Y", fmin.y, ":", fmax.y);
+  else
+    SERIAL_ECHOPGM("Footprint none");
+  SERIAL_ECHOPGM(" Zones:");
+  LOOP_L_N(b, BED_COUNT) if (zone_active(b)) { SERIAL_CHAR(' '); SERIAL_ECHO(b); }
+  SERIAL_EOL();
+}
+
+#endif // BED_ZONE_FOOTPRINT
@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/bed_footprint.h - Select the bed zones under the print footprint
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class BedFootprint {
+public:
+  static uint8_t zone_mask;           // Bit n set if bed zone n is under the footprint
+  static bool valid;                  // A footprint is set. If not, all zones are active.
+  static xy_pos_t fmin, fmax;         // Footprint bounds, without the margin
+
+  static bool zone_active(const uint8_t bed) { return TEST(zone_mask, bed); }
+
+  // Forget the footprint and activate all zones
+  static void reset();
+
+  // Grow the footprint to include the given rectangle
+  static void include(const xy_pos_t &lo, const xy_pos_t &hi);
+
+  // Replace the footprint with the given rectangle
+  static void set(const xy_pos_t &lo, const xy_pos_t &hi) { reset(); include(lo, hi); }
+
+  #if ENABLED(SDSUPPORT)
+    static bool scanning;             // The SD file is being scanned, a bit per idle()
+
+    // Start scanning the open SD file for its extrusion extents
+    static void prescan();
+    static void prescan_task();
+    static void finish_prescan();
+    static void cancel_prescan() { scanning = false; }
+  #endif
+
+  static void report();
+
+private:
+  static void update_mask();
+};
+
+extern BedFootprint bedfootprint;
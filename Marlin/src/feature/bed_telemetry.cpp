@@ -0,0 +1,158 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/bed_telemetry.cpp - Rate-limited telemetry of the bed zones
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BED_TELEMETRY)
+
+#include "bed_telemetry.h"
+#include "../module/temperature.h"
+#include "../gcode/queue.h"
+
+#if ENABLED(BED_TELEMETRY_BINARY)
+  #include "../libs/crc16.h"
+#endif
+
+BedTelemetry bedtelemetry;
+
+uint8_t BedTelemetry::rate_hz; // = 0
+bool BedTelemetry::binary; // = false
+millis_t BedTelemetry::next_ms; // = 0
+uint16_t BedTelemetry::seq; // = 0
+#if HAS_MULTI_SERIAL
+  SerialMask BedTelemetry::port_mask = SerialMask::All;
+#endif
+#if ENABLED(BED_TELEMETRY_BINARY)
+  serial_index_t BedTelemetry::binary_port;
+#endif
+
+// Bytes per report, for the bandwidth budget
+#define BT_PAYLOAD_BYTES (8 + 5 * (BED_COUNT))
+#define BT_FRAME_BYTES   (2 + 1 + BT_PAYLOAD_BYTES + 2)
+#define BT_LINE_BYTES    (14 + 17 * (BED_COUNT))   // "BT:4294967295" and " 0:100.00/100@127" per zone
+
+uint8_t BedTelemetry::max_rate() {
+  constexpr uint32_t budget = uint32_t(BAUDRATE) / 10 * (BED_TELEMETRY_BUDGET) / 100; // Bytes per second
+  const uint32_t hz = budget / (binary ? BT_FRAME_BYTES : BT_LINE_BYTES);
+  return constrain(hz, 1, BED_TELEMETRY_MAX_HZ);
+}
+
+uint8_t BedTelemetry::set_rate(const uint8_t hz) {
+  rate_hz = _MIN(hz, max_rate());
+  next_ms = millis();
+  // Report to the port that asked
+  TERN_(HAS_MULTI_SERIAL, port_mask = SERIAL_PORTMASK(queue.ring_buffer.command_port()));
+  return rate_hz;
+}
+
+bool BedTelemetry::set_binary(const bool onoff, const int8_t port) {
+  #if ENABLED(BED_TELEMETRY_BINARY)
+    // Frames need a port of their own
+    if (onoff) {
+      if (!WITHIN(port, 0, NUM_SERIAL - 1) || port == queue.ring_buffer.command_port().index) return false;
+      binary_port = port;
+    }
+    binary = onoff;
+  #else
+    UNUSED(onoff); UNUSED(port);
+  #endif
+  NOMORE(rate_hz, max_rate());
+  return true;
+}
+
+void BedTelemetry::tick() {
+  if (!rate_hz) return;
+  const millis_t ms = millis();
+  if (PENDING(ms, next_ms)) return;
+  // Keep a steady cadence, but don't try to catch up on missed reports
+  next_ms += 1000UL / rate_hz;
+  if (ELAPSED(ms, next_ms)) next_ms = ms + 1000UL / rate_hz;
+
+  // Frames go only to their own port, lines to the port that asked for them
+  #if ENABLED(BED_TELEMETRY_BINARY)
+    if (binary) {
+      PORT_REDIRECT(SERIAL_PORTMASK(binary_port));
+      send_frame(ms);
+    }
+    else
+  #endif
+    {
+      PORT_REDIRECT(port_mask);
+      send_line(ms);
+    }
+  seq++;
+}
+
+void BedTelemetry::send_line(const millis_t ms) {
+  SERIAL_ECHOPGM("BT:", ms);
+  LOOP_L_N(b, BED_COUNT) {
+    SERIAL_ECHOPGM(" ", b, ":");
+    SERIAL_ECHO_F(thermalManager.degBed(b), 2);
+    SERIAL_ECHOPGM("/", thermalManager.degTargetBed(b), "@", thermalManager.getHeaterPower(heater_id_t(H_BED0 - b)));
+  }
+  SERIAL_EOL();
+}
+
+#if ENABLED(BED_TELEMETRY_BINARY)
+
+  void BedTelemetry::send_frame(const millis_t ms) {
+    uint8_t frame[BT_FRAME_BYTES], *p = frame;
+    auto put8  = [&](const uint8_t v)  { *p++ = v; };
+    auto put16 = [&](const uint16_t v) { put8(v & 0xFF); put8(v >> 8); };
+    auto put32 = [&](const uint32_t v) { put16(v & 0xFFFF); put16(v >> 16); };
+
+    put8(0xA5); put8(0x5A);
+    put8(BT_PAYLOAD_BYTES);
+    put8('B');
+    put16(seq);
+    put32(ms);
+    put8(BED_COUNT);
+    LOOP_L_N(b, BED_COUNT) {
+      put16(uint16_t(int16_t(LROUND(thermalManager.degBed(b) * 100.0f))));
+      put16(uint16_t(thermalManager.degTargetBed(b)));
+      put8(uint8_t(thermalManager.getHeaterPower(heater_id_t(H_BED0 - b))));
+    }
+
+    uint16_t crc = 0;
+    crc16(&crc, frame + 2, 1 + BT_PAYLOAD_BYTES);
+    put16(crc);
+
+    LOOP_L_N(i, BT_FRAME_BYTES) SERIAL_IMPL.write(frame[i]);
+  }
+
+#endif // BED_TELEMETRY_BINARY
+
+void BedTelemetry::report_settings() {
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("Bed telemetry:", rate_hz, "Hz ");
+  #if ENABLED(BED_TELEMETRY_BINARY)
+    if (binary) SERIAL_ECHOPGM("binary P", binary_port.index); else
+  #endif
+      SERIAL_ECHOPGM("text");
+  SERIAL_ECHOLNPGM(" max:", max_rate(), "Hz");
+}
+
+#endif // BED_TELEMETRY
@@ -0,0 +1,80 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/bed_telemetry.h - Rate-limited telemetry of the bed zones
+ *
+ * Started with M155 B<hz>. Each report holds every bed zone's temperature,
+ * target and power, either as one text line:
+ *
+ *   BT:<ms> 0:<temp>/<target>@<power> 1:...
+ *
+ * or, with BED_TELEMETRY_BINARY and M155 F1 P<port>, as a framed binary record.
+ * Frames only go to serial port <port>, which can't be the port sending the
+ * M155, so they never land between the replies to commands:
+ *
+ *   0xA5 0x5A <len> <payload...> <crc16 LSB> <crc16 MSB>
+ *
+ *   payload : 'B' seq:u16 ms:u32 count:u8, then per zone temp:i16 (0.01°C) target:i16 (°C) power:u8
+ *   crc16   : libs/crc16 over <len> and the payload
+ *
+ * Integers are little-endian. The rate is capped so reports stay within
+ * BED_TELEMETRY_BUDGET percent of the serial bandwidth.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class BedTelemetry {
+public:
+  static uint8_t rate_hz;             // Reports per second. 0 = off.
+  static bool binary;                 // Binary frames instead of text lines
+
+  // Set the report rate, clamped to the serial budget. Return the rate applied.
+  static uint8_t set_rate(const uint8_t hz);
+
+  // Send binary frames to the given port, or text lines. False if the port can't be used.
+  static bool set_binary(const bool onoff, const int8_t port);
+
+  // Send a report when due. Called from idle().
+  static void tick();
+
+  static void report_settings();
+
+private:
+  static millis_t next_ms;
+  static uint16_t seq;
+  #if HAS_MULTI_SERIAL
+    static SerialMask port_mask;
+  #endif
+  #if ENABLED(BED_TELEMETRY_BINARY)
+    static serial_index_t binary_port;
+  #endif
+
+  static uint8_t max_rate();
+  static void send_line(const millis_t ms);
+  #if ENABLED(BED_TELEMETRY_BINARY)
+    static void send_frame(const millis_t ms);
+  #endif
+};
+
+extern BedTelemetry bedtelemetry;
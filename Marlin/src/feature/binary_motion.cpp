@@ -0,0 +1,163 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/binary_motion.cpp - Pre-tokenized G-code over the binary stream
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_MOTION_COMMANDS)
+
+#include "binary_motion.h"
+#include "../gcode/queue.h"
+#include "../sd/cardreader.h"
+
+static const char param_letters[] PROGMEM = BINARY_MOTION_PARAMS;
+static_assert(COUNT(param_letters) == 26 + 1, "BINARY_MOTION_PARAMS must list the letters A-Z.");
+#if DISABLED(PARSED_COMMAND_QUEUE)
+  static_assert(sizeof(GCodeRecord) <= MAX_CMD_SIZE, "GCodeRecord must fit in MAX_CMD_SIZE.");
+#endif
+
+// Read an unsigned LEB128 varint. False if it runs past the end or 32 bits.
+static bool read_varint(const uint8_t *&p, const uint8_t * const end, uint32_t &v) {
+  v = 0;
+  for (uint8_t shift = 0; shift < 32; shift += 7) {
+    if (p >= end) return false;
+    const uint8_t b = *p++;
+    v |= uint32_t(b & 0x7F) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+bool BinaryMotionProtocol::tokenized(const char letter, const uint16_t codenum) {
+  switch (letter) {
+    case 'G':
+      switch (codenum) {
+        case 0 ... 5: case 10: case 11: case 28: case 90: case 91: case 92:
+          return true;
+      }
+      break;
+    case 'M':
+      switch (codenum) {
+        case 3 ... 5: case 17: case 18: case 82 ... 84:
+        case 104: case 106: case 107: case 109: case 140: case 190:
+        case 204: case 205: case 220: case 221: case 400:
+          return true;
+      }
+      break;
+    case 'T':
+      return true;
+  }
+  return false;
+}
+
+bool BinaryMotionProtocol::ready(const uint8_t packet_type, const char *buffer, const uint16_t length) {
+  if (static_cast<Packet>(packet_type) != Packet::COMMANDS || !length) return true;
+  const uint8_t count = buffer[0];
+  return count > BUFSIZE || !queue.ring_buffer.full(count); // Too many is rejected by valid()
+}
+
+bool BinaryMotionProtocol::valid(const uint8_t packet_type, const char *buffer, const uint16_t length) {
+  switch (static_cast<Packet>(packet_type)) {
+    case Packet::QUERY: return true;
+    case Packet::COMMANDS: {
+      const uint8_t *p = (const uint8_t*)buffer, * const end = p + length;
+      uint8_t count = length ? *p++ : 0;
+      if (!count || count > BUFSIZE) return false;
+      while (count--) if (!read_command(p, end, false)) return false;
+      return p == end;
+    }
+    default: return false;
+  }
+}
+
+/**
+ * Decode the next command of the packet, and put it in the command queue if enqueue is set
+ */
+bool BinaryMotionProtocol::read_command(const uint8_t *&p, const uint8_t * const end, const bool enqueue) {
+  if (p >= end) return false;
+  const uint8_t lead = *p++;
+
+  // A text command goes to the queue as if it came from the serial port
+  if (!lead) {
+    const char * const text = (const char*)p;
+    while (p < end && *p) p++;
+    if (p >= end || (const char*)p - text >= MAX_CMD_SIZE) return false;
+    p++;
+    if (enqueue && *text) queue.ring_buffer.enqueue(text, true OPTARG(HAS_MULTI_SERIAL, card.transfer_port_index));
+    return true;
+  }
+
+  const char letter = lead & 0x7F;
+  uint32_t codenum, valuebits, flagbits = 0;
+  if (!read_varint(p, end, codenum) || !read_varint(p, end, valuebits)) return false;
+  if ((lead & 0x80) && !read_varint(p, end, flagbits)) return false;
+  if (!tokenized(letter, codenum) || (valuebits | flagbits) >> 26) return false;
+
+  GCodeRecord scratch, &rec = enqueue ? queue.ring_buffer.record_slot() : scratch;
+  rec.letter = letter;
+  rec.codenum = codenum;
+  TERN_(USE_GCODE_SUBCODES, rec.subcode = 0);
+  rec.command = rec.string_arg = 0;             // No text
+  rec.codebits = 0;
+  rec.count = 0;
+
+  for (uint8_t b = 0; valuebits; ++b, valuebits >>= 1) {
+    if (!(valuebits & 1)) continue;
+    uint32_t v;
+    if (rec.count >= GCODE_RECORD_VALUES || !read_varint(p, end, v)) return false;
+    const uint8_t ind = LETTER_BIT(pgm_read_byte(&param_letters[b]));
+    const uint32_t zz = v >> 3;
+    // A float holds the mantissa exactly below 2^24, as GCodeParser::fixed_point() requires
+    if ((v & 0x07) && (zz >> 1) + (zz & 1) >= _BV32(24)) return false;
+    rec.value[rec.count] = int32_t(zz >> 1) ^ -int32_t(zz & 1);
+    rec.decimals[rec.count] = v & 0x07;
+    rec.offset[rec.count] = 0;
+    rec.param[rec.count++] = ind;
+    SBI32(rec.codebits, ind);
+  }
+
+  for (uint8_t b = 0; flagbits; ++b, flagbits >>= 1)
+    if (flagbits & 1) SBI32(rec.codebits, LETTER_BIT(pgm_read_byte(&param_letters[b])));
+
+  if (enqueue) queue.ring_buffer.commit_record(TERN_(HAS_MULTI_SERIAL, card.transfer_port_index));
+  return true;
+}
+
+void BinaryMotionProtocol::process(const uint8_t packet_type, char *buffer, const uint16_t length) {
+  switch (static_cast<Packet>(packet_type)) {
+    case Packet::QUERY:
+      SERIAL_ECHOLNPGM("PMC:version:", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH,
+                       ":commands:", BUFSIZE, ":values:", GCODE_RECORD_VALUES);
+      break;
+    case Packet::COMMANDS: {
+      // Checked by valid() before the packet was acknowledged
+      const uint8_t *p = (const uint8_t*)buffer, * const end = p + length;
+      for (uint8_t count = *p++; count--;) read_command(p, end, true);
+    } break;
+    default: break;
+  }
+}
+
+#endif // BINARY_MOTION_COMMANDS
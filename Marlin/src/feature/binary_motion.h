@@ -0,0 +1,72 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/binary_motion.h - Pre-tokenized G-code over the binary stream
+ *
+ * Protocol 2 of the binary stream ('M28 B1'). A COMMANDS packet holds a count
+ * byte and then that many commands:
+ *
+ *   G/M/T command : letter:u8 code:var values:var [flags:var] value:var...
+ *   text command  : 0x00 <G-code text> 0x00
+ *
+ *   letter : 'G', 'M' or 'T', plus 0x80 when a flags mask follows
+ *   values : Mask of the parameters with a value, by BINARY_MOTION_PARAMS order
+ *   flags  : Mask of the parameters without a value
+ *   value  : (zigzag(mantissa) << 3) | decimals, for mantissa / 10^decimals
+ *
+ * 'var' is an unsigned LEB128 varint of up to 32 bits. The values follow in
+ * mask order. Pre-tokenized commands go straight to the command queue as
+ * records, so the parser never sees their text. Only the commands listed in
+ * BinaryMotionProtocol::tokenized() may be sent that way. The packet is only
+ * acknowledged once the command queue has room for all of its commands, and
+ * only if all of them decode, with every mantissa that has decimals under 2^24.
+ * A packet that doesn't is answered with "PMC:invalid<sync>" instead of "ok",
+ * and none of its commands are queued.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+// Parameter letters by mask bit, the usual motion parameters first
+#define BINARY_MOTION_PARAMS "XYZEFIJRSPABCDGHKLMNOQTUVW"
+
+class BinaryMotionProtocol {
+public:
+  enum class Packet : uint8_t { QUERY, COMMANDS };
+
+  // True if a command may be sent pre-tokenized
+  static bool tokenized(const char letter, const uint16_t codenum);
+
+  // True once the command queue has room for the packet
+  static bool ready(const uint8_t packet_type, const char *buffer, const uint16_t length);
+
+  // True if the whole packet decodes. Checked before the packet is acknowledged.
+  static bool valid(const uint8_t packet_type, const char *buffer, const uint16_t length);
+
+  static void process(const uint8_t packet_type, char *buffer, const uint16_t length);
+
+  static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
+
+private:
+  static bool read_command(const uint8_t *&p, const uint8_t * const end, const bool enqueue);
+};
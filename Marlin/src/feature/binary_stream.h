@@ -23,6 +23,10 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if ENABLED(BINARY_MOTION_COMMANDS)
+  #include "binary_motion.h"
+#endif
+
 #define BINARY_STREAM_COMPRESSION
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   #include "../libs/heatshrink/heatshrink_decoder.h"
@@ -199,7 +203,7 @@ public:
 
 class BinaryStream {
 public:
-  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER, MOTION };
 
   enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
 
@@ -266,20 +270,20 @@ public:
   // whether the stream times out from data starvation
   // takes the data variable by reference in order to return status
   bool stream_read(uint8_t& data) {
-    if (stream_state != StreamState::PACKET_WAIT && ELAPSED(millis(), packet.timeout)) {
-      stream_state = StreamState::PACKET_TIMEOUT;
+    if (!bs_serial_data_available(card.transfer_port_index)) {
+      if (stream_state != StreamState::PACKET_WAIT && ELAPSED(now, packet.timeout))
+        stream_state = StreamState::PACKET_TIMEOUT;
       return false;
     }
-    if (!bs_serial_data_available(card.transfer_port_index)) return false;
     data = bs_read_serial(card.transfer_port_index);
-    packet.timeout = millis() + PACKET_MAX_WAIT;
+    packet.timeout = now + PACKET_MAX_WAIT;
     return true;
   }
 
   template<const size_t buffer_size>
   void receive(char (&buffer)[buffer_size]) {
     uint8_t data = 0;
-    millis_t transfer_window = millis() + RX_TIMESLICE;
+    const millis_t transfer_window = millis() + RX_TIMESLICE;
 
     #if ENABLED(SDSUPPORT)
       PORT_REDIRECT(SERIAL_PORTMASK(card.transfer_port_index));
@@ -288,7 +292,8 @@ public:
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Warray-bounds"
 
-    while (PENDING(millis(), transfer_window)) {
+    // The clock is read on every pass, so a steady stream still ends its slice and lets idle() run
+    while (PENDING((now = millis()), transfer_window)) {
       switch (stream_state) {
          /**
           * Data stream packet handling
@@ -389,6 +394,18 @@ public:
           }
           break;
         case StreamState::PACKET_PROCESS:
+          #if ENABLED(BINARY_MOTION_COMMANDS)
+            if (static_cast<Protocol>(packet.header.protocol()) == Protocol::MOTION) {
+              // Hold the packet and its "ok" until the command queue has room for it
+              if (!BinaryMotionProtocol::ready(packet.header.type(), packet.buffer, packet.header.size)) return;
+              // Refuse a packet that doesn't decode whole, before any of it is queued or acknowledged
+              if (!BinaryMotionProtocol::valid(packet.header.type(), packet.buffer, packet.header.size)) {
+                SERIAL_ECHOLNPGM("PMC:invalid", packet.header.sync);
+                stream_state = StreamState::PACKET_RESET;
+                break;
+              }
+            }
+          #endif
           sync++;
           packet_retries = 0;
           bytes_received += packet.header.size;
@@ -436,6 +453,11 @@ public:
       case Protocol::FILE_TRANSFER:
         SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
       break;
+      #if ENABLED(BINARY_MOTION_COMMANDS)
+        case Protocol::MOTION:
+          BinaryMotionProtocol::process(packet.header.type(), packet.buffer, packet.header.size);
+          break;
+      #endif
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
     }
@@ -450,6 +472,7 @@ public:
   uint8_t  packet_retries, sync;
   uint16_t buffer_next_index;
   uint32_t bytes_received;
+  millis_t now;
   StreamState stream_state = StreamState::PACKET_RESET;
 };
 
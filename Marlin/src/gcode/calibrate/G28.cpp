@@ -336,6 +336,16 @@ void GcodeSuite::G28() {
     motion_state_t saved_motion_state = begin_slow_homing();
   #endif
 
+  // Echoes would carry the axes on past the endstops, so home without shaping
+  #if ENABLED(INPUT_SHAPING_X)
+    const float saved_shaping_freq_x = stepper.get_shaping_frequency(X_AXIS);
+    stepper.set_shaping_frequency(X_AXIS, 0.0f);
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    const float saved_shaping_freq_y = stepper.get_shaping_frequency(Y_AXIS);
+    stepper.set_shaping_frequency(Y_AXIS, 0.0f);
+  #endif
+
   // Always home with tool 0 active
   #if HAS_MULTI_HOTEND
     #if DISABLED(DELTA) || ENABLED(DELTA_HOME_TO_SAFE_ZONE)
@@ -512,6 +522,9 @@ void GcodeSuite::G28() {
 
   endstops.not_homing();
 
+  TERN_(INPUT_SHAPING_X, stepper.set_shaping_frequency(X_AXIS, saved_shaping_freq_x));
+  TERN_(INPUT_SHAPING_Y, stepper.set_shaping_frequency(Y_AXIS, saved_shaping_freq_y));
+
   // Clear endstop state for polled stallGuard endstops
   TERN_(SPI_ENDSTOPS, endstops.clear_endstop_state());
 
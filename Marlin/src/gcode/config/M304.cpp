@@ -30,24 +30,53 @@
 /**
  * M304 - Set and/or Report the current Bed PID values
  *
+ *  B<zone> - Bed zone to set, with a multi-zone bed (Default: all zones)
  *  P<pval> - Set the P value
  *  I<ival> - Set the I value
  *  D<dval> - Set the D value
  */
 void GcodeSuite::M304() {
   if (!parser.seen("PID")) return M304_report();
-  if (parser.seenval('P')) thermalManager.temp_bed.pid.Kp = parser.value_float();
-  if (parser.seenval('I')) thermalManager.temp_bed.pid.Ki = scalePID_i(parser.value_float());
-  if (parser.seenval('D')) thermalManager.temp_bed.pid.Kd = scalePID_d(parser.value_float());
+
+  #if HAS_MULTI_BEDS
+    const int8_t bed = parser.intval('B', -1);
+    if (bed >= BED_COUNT) {
+      SERIAL_ERROR_MSG(STR_INVALID_BED_ZONE);
+      return;
+    }
+    for (uint8_t b = 0; b < BED_COUNT; ++b) {
+      if (bed >= 0 && b != bed) continue;
+      if (parser.seenval('P')) thermalManager.temp_bed[b].pid.Kp = parser.value_float();
+      if (parser.seenval('I')) thermalManager.temp_bed[b].pid.Ki = scalePID_i(parser.value_float());
+      if (parser.seenval('D')) thermalManager.temp_bed[b].pid.Kd = scalePID_d(parser.value_float());
+    }
+  #else
+    if (parser.seenval('P')) thermalManager.temp_bed.pid.Kp = parser.value_float();
+    if (parser.seenval('I')) thermalManager.temp_bed.pid.Ki = scalePID_i(parser.value_float());
+    if (parser.seenval('D')) thermalManager.temp_bed.pid.Kd = scalePID_d(parser.value_float());
+  #endif
 }
 
 void GcodeSuite::M304_report(const bool forReplay/*=true*/) {
-  report_heading_etc(forReplay, F(STR_BED_PID));
-  SERIAL_ECHOLNPGM(
-      "  M304 P", thermalManager.temp_bed.pid.Kp
-    , " I", unscalePID_i(thermalManager.temp_bed.pid.Ki)
-    , " D", unscalePID_d(thermalManager.temp_bed.pid.Kd)
-  );
+  #if HAS_MULTI_BEDS
+    report_heading(forReplay, F(STR_BED_PID));
+    for (uint8_t b = 0; b < BED_COUNT; ++b) {
+      report_echo_start(forReplay);
+      SERIAL_ECHOLNPGM(
+          "  M304 B", b
+        , " P", thermalManager.temp_bed[b].pid.Kp
+        , " I", unscalePID_i(thermalManager.temp_bed[b].pid.Ki)
+        , " D", unscalePID_d(thermalManager.temp_bed[b].pid.Kd)
+      );
+    }
+  #else
+    report_heading_etc(forReplay, F(STR_BED_PID));
+    SERIAL_ECHOLNPGM(
+        "  M304 P", thermalManager.temp_bed.pid.Kp
+      , " I", unscalePID_i(thermalManager.temp_bed.pid.Ki)
+      , " D", unscalePID_d(thermalManager.temp_bed.pid.Kd)
+    );
+  #endif
 }
 
 #endif // PIDTEMPBED
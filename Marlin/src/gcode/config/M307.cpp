@@ -0,0 +1,87 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(BED_ZONE_COUPLING)
+
+#include "../gcode.h"
+#include "../../module/temperature.h"
+
+/**
+ * M307 - Set and/or Report the bed zone thermal coupling matrix
+ *
+ *  B<zone>   - Zone being heated (matrix column)
+ *  C<zone>   - Zone receiving heat (matrix row)
+ *  S<gain>   - Degrees of rise in zone C per degree of rise in zone B
+ *  P<gain>   - Degrees of rise in zone B at full power, without C
+ *  R         - Reset to no coupling
+ *
+ * Both gains are identified by "M303 E-1 B<zone> U1". The self gains
+ * only matter relative to each other, to weigh the zones' power.
+ */
+void GcodeSuite::M307() {
+  if (parser.seen_test('R')) return thermalManager.reset_bed_coupling();
+
+  if (!parser.seen("BCSP")) return M307_report();
+
+  const int8_t col = parser.intval('B', -1);
+  if (parser.seenval('P')) {
+    if (!WITHIN(col, 0, BED_COUNT - 1)) {
+      SERIAL_ERROR_MSG(STR_INVALID_BED_ZONE);
+      return;
+    }
+    thermalManager.bed_zone_gain[col] = _MAX(parser.value_float(), 0.1f);
+    thermalManager.update_bed_decoupling();
+    if (!parser.seen("CS")) return;
+  }
+
+  const int8_t row = parser.intval('C', -1);
+  if (!WITHIN(col, 0, BED_COUNT - 1) || !WITHIN(row, 0, BED_COUNT - 1) || col == row) {
+    SERIAL_ERROR_MSG(STR_INVALID_BED_ZONE);
+    return;
+  }
+  if (parser.seenval('S')) {
+    thermalManager.bed_coupling[row][col] = constrain(parser.value_float(), 0, 0.9f);
+    thermalManager.update_bed_decoupling();
+  }
+}
+
+void GcodeSuite::M307_report(const bool forReplay/*=true*/) {
+  report_heading(forReplay, F(STR_BED_ZONE_COUPLING));
+  for (uint8_t n = 0; n < BED_COUNT; ++n) {
+    report_echo_start(forReplay);
+    SERIAL_ECHOPGM("  M307 B", n, " P");
+    SERIAL_ECHO_F(thermalManager.bed_zone_gain[n], 1);
+    SERIAL_EOL();
+  }
+  for (uint8_t n = 0; n < BED_COUNT; ++n)
+    for (uint8_t j = 0; j < BED_COUNT; ++j) {
+      if (j == n) continue;
+      report_echo_start(forReplay);
+      SERIAL_ECHOPGM("  M307 B", n, " C", j, " S");
+      SERIAL_ECHO_F(thermalManager.bed_coupling[j][n], 3);
+      SERIAL_EOL();
+    }
+}
+
+#endif // BED_ZONE_COUPLING
@@ -0,0 +1,72 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ADS1115_BED_READING
+
+#include "../gcode.h"
+#include "../../module/temperature.h"
+
+/**
+ * M308 - Set and/or Report the bed ADC (ADS1115) acquisition settings
+ *
+ *  R<sps>    - Conversion rate: 8, 16, 32, 64, 128, 250, 475 or 860 samples per second
+ *  S<count>  - Conversions per reading, combined by median (1-7)
+ *  F<shift>  - Smoothing across readings. A new reading has weight 1/2^F. (0 = off)
+ *
+ * Settings that would take longer than ADS1115_STALE_MS / 2 to sweep all zones are refused.
+ */
+void GcodeSuite::M308() {
+  if (!parser.seen("RSF")) return M308_report();
+
+  Temperature::ads1115_settings_t s = thermalManager.ads1115_settings;
+
+  if (parser.seenval('R')) {
+    const uint16_t sps = parser.value_ushort();
+    uint8_t rate = 0;
+    while (rate < 7 && thermalManager.ads1115_sps(rate) != sps) rate++;
+    if (thermalManager.ads1115_sps(rate) != sps) {
+      SERIAL_ERROR_MSG(STR_ERR_ADS1115_RATE);
+      return;
+    }
+    s.data_rate = rate;
+  }
+  if (parser.seenval('S')) s.samples = constrain(parser.value_byte(), 1, ADS1115_SAMPLES_MAX);
+  if (parser.seenval('F')) s.iir_shift = constrain(parser.value_byte(), 0, 6);
+
+  if (thermalManager.ads1115_sweep_ms(s) > (ADS1115_STALE_MS) / 2) {
+    SERIAL_ERROR_MSG(STR_ERR_ADS1115_SWEEP);
+    return;
+  }
+
+  thermalManager.ads1115_settings = s;
+  thermalManager.ads1115_reset_filters(); // Restart smoothing from the next reading at the new settings
+}
+
+void GcodeSuite::M308_report(const bool forReplay/*=true*/) {
+  const Temperature::ads1115_settings_t &s = thermalManager.ads1115_settings;
+  report_heading_etc(forReplay, F(STR_BED_ADC));
+  SERIAL_ECHOLNPGM("  M308 R", thermalManager.ads1115_sps(s.data_rate), " S", s.samples, " F", s.iir_shift);
+}
+
+#endif // ADS1115_BED_READING
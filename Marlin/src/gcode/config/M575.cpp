@@ -25,15 +25,63 @@
 #if ENABLED(BAUD_RATE_GCODE)
 
 #include "../gcode.h"
+#include "../queue.h"
+#include "../../MarlinCore.h" // for idle()
+
+#ifndef BAUDRATE_2
+  #define BAUDRATE_2 BAUDRATE
+#endif
+#ifndef BAUDRATE_3
+  #define BAUDRATE_3 BAUDRATE
+#endif
+
+// The rate of each port, to go back to
+static uint32_t port_baud[] = {
+  BAUDRATE
+  #if HAS_MULTI_SERIAL
+    , BAUDRATE_2
+    #ifdef SERIAL_PORT_3
+      , BAUDRATE_3
+    #endif
+  #endif
+};
+
+static void set_baud(const uint8_t mask, const uint32_t baud) {
+  SERIAL_FLUSH();
+  if (TEST(mask, 0)) { MYSERIAL1.end(); MYSERIAL1.begin(baud); port_baud[0] = baud; }
+  #if HAS_MULTI_SERIAL
+    if (TEST(mask, 1)) { MYSERIAL2.end(); MYSERIAL2.begin(baud); port_baud[1] = baud; }
+    #ifdef SERIAL_PORT_3
+      if (TEST(mask, 2)) { MYSERIAL3.end(); MYSERIAL3.begin(baud); port_baud[2] = baud; }
+    #endif
+  #endif
+}
 
 /**
  * M575 - Change serial baud rate
  *
  *   P<index>    - Serial port index. Omit for all.
- *   B<baudrate> - Baud rate (bits per second)
+ *   B<baudrate> - Baud rate (bits per second). Omit to report the rates.
+ *   S<ms>       - Keep the new rate on each port only if a line with a valid line
+ *                 number and checksum arrives on it within <ms>.
+ *                 Otherwise go back to the old rate.
+ *
+ * With S the host can try a rate, up to 2000000, that the link may not carry:
+ * it switches after the "baud rate set" line and sends a command with a line
+ * number and checksum. The "ok" for M575 comes at the rate that was kept.
+ * The command queue needs room for that line, or S is refused.
  */
 void GcodeSuite::M575() {
-  int32_t baud = parser.ulongval('B');
+  const int8_t port = parser.intval('P', -99);
+  const uint8_t mask = port == -99 ? 0xFF : WITHIN(port, 0, int8_t(COUNT(port_baud)) - 1) ? _BV(port) : 0;
+
+  if (!parser.seenval('B')) {
+    LOOP_L_N(i, COUNT(port_baud))
+      if (TEST(mask, i)) SERIAL_ECHO_MSG(" Serial ", AS_DIGIT(i), " baud rate ", port_baud[i]);
+    return;
+  }
+
+  int32_t baud = parser.value_ulong();
   switch (baud) {
     case   24:
     case   96:
@@ -42,7 +90,10 @@ void GcodeSuite::M575() {
     case  576:
     case 1152: baud *= 100; break;
     case  250:
-    case  500: baud *= 1000; break;
+    case  500:
+    case 1000:
+    case 1500:
+    case 2000: baud *= 1000; break;
     case   19: baud = 19200; break;
     case   38: baud = 38400; break;
     case   57: baud = 57600; break;
@@ -50,28 +101,42 @@ void GcodeSuite::M575() {
   }
   switch (baud) {
     case 2400: case 9600: case 19200: case 38400: case 57600:
-    case 115200: case 250000: case 500000: case 1000000: {
-      const int8_t port = parser.intval('P', -99);
-      const bool set1 = (port == -99 || port == 0);
-      if (set1) SERIAL_ECHO_MSG(" Serial ", AS_DIGIT(0), " baud rate set to ", baud);
-      #if HAS_MULTI_SERIAL
-        const bool set2 = (port == -99 || port == 1);
-        if (set2) SERIAL_ECHO_MSG(" Serial ", AS_DIGIT(1), " baud rate set to ", baud);
-        #ifdef SERIAL_PORT_3
-          const bool set3 = (port == -99 || port == 2);
-          if (set3) SERIAL_ECHO_MSG(" Serial ", AS_DIGIT(2), " baud rate set to ", baud);
-        #endif
-      #endif
+    case 115200: case 250000: case 500000: case 1000000: case 1500000: case 2000000: {
+      const bool trial = parser.seenval('S');
+      const millis_t trial_ms = trial ? parser.value_millis() : 0;
+      if (trial) {
+        // Take in the lines sent at the old rate, so only a line at the new rate counts
+        SERIAL_FLUSH();
+        queue.get_available_commands();
+        if (queue.ring_buffer.full()) {
+          SERIAL_ERROR_MSG("M575 S needs room in the command queue.");
+          return;
+        }
+      }
+
+      uint32_t old_baud[COUNT(port_baud)];
+      LOOP_L_N(i, COUNT(port_baud)) {
+        old_baud[i] = port_baud[i];
+        if (TEST(mask, i)) SERIAL_ECHO_MSG(" Serial ", AS_DIGIT(i), " baud rate set to ", baud);
+      }
+
+      set_baud(mask, baud);
 
-      SERIAL_FLUSH();
+      if (trial) {
+        // Wait for a numbered, checksummed line at the new rate on each port
+        uint8_t lines[COUNT(port_baud)], waiting = mask & (_BV(COUNT(port_baud)) - 1);
+        LOOP_L_N(i, COUNT(port_baud)) lines[i] = queue.serial_state[i].numbered_lines;
+        const millis_t timeout = millis() + trial_ms;
+        while (waiting && PENDING(millis(), timeout)) {
+          idle();
+          LOOP_L_N(i, COUNT(port_baud)) if (queue.serial_state[i].numbered_lines != lines[i]) CBI(waiting, i);
+        }
 
-      if (set1) { MYSERIAL1.end(); MYSERIAL1.begin(baud); }
-      #if HAS_MULTI_SERIAL
-        if (set2) { MYSERIAL2.end(); MYSERIAL2.begin(baud); }
-        #ifdef SERIAL_PORT_3
-          if (set3) { MYSERIAL3.end(); MYSERIAL3.begin(baud); }
-        #endif
-      #endif
+        LOOP_L_N(i, COUNT(port_baud)) if (TEST(waiting, i)) {
+          set_baud(_BV(i), old_baud[i]);
+          SERIAL_ECHO_MSG(" Serial ", AS_DIGIT(i), " baud rate back to ", old_baud[i]);
+        }
+      }
 
     } break;
     default: SERIAL_ECHO_MSG("?(B)aud rate implausible.");
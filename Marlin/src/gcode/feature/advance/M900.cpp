@@ -27,6 +27,10 @@
 #include "../../gcode.h"
 #include "../../../module/planner.h"
 
+#if ENABLED(SMOOTH_LIN_ADVANCE)
+  #include "../../../module/ft_motion.h"
+#endif
+
 #if ENABLED(EXTRA_LIN_ADVANCE_K)
   float other_extruder_advance_K[EXTRUDERS];
   uint8_t lin_adv_slot = 0;
@@ -38,6 +42,7 @@
  *  K<factor>   Set current advance K factor (Slot 0).
  *  L<factor>   Set secondary advance K factor (Slot 1). Requires EXTRA_LIN_ADVANCE_K.
  *  S<0/1>      Activate slot 0 or 1. Requires EXTRA_LIN_ADVANCE_K.
+ *  U<seconds>  Set the time to average the E speed over, up to 0.1s. Requires SMOOTH_LIN_ADVANCE.
  */
 void GcodeSuite::M900() {
 
@@ -109,6 +114,16 @@ void GcodeSuite::M900() {
     kref = newK;
   }
 
+  #if ENABLED(SMOOTH_LIN_ADVANCE)
+    if (parser.seenval('U')) {
+      const float U = parser.value_float();
+      if (WITHIN(U, 0, FTM_ADVANCE_MAX_TIME))
+        ftMotion.set_advance_time(U);
+      else
+        echo_value_oor('U', false);
+    }
+  #endif
+
   if (!parser.seen_any()) {
 
     #if ENABLED(EXTRA_LIN_ADVANCE_K)
@@ -139,6 +154,10 @@ void GcodeSuite::M900() {
       #endif
 
     #endif
+
+    #if ENABLED(SMOOTH_LIN_ADVANCE)
+      SERIAL_ECHO_MSG("Advance U=", ftMotion.get_advance_time());
+    #endif
   }
 
 }
@@ -154,6 +173,10 @@ void GcodeSuite::M900_report(const bool forReplay/*=true*/) {
       SERIAL_ECHOLNPGM("  M900 T", e, " K", planner.extruder_advance_K[e]);
     }
   #endif
+  #if ENABLED(SMOOTH_LIN_ADVANCE)
+    report_echo_start(forReplay);
+    SERIAL_ECHOLNPGM("  M900 U", ftMotion.get_advance_time());
+  #endif
 }
 
 #endif // LIN_ADVANCE
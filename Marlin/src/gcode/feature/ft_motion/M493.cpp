@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(FT_MOTION)
+
+#include "../../gcode.h"
+#include "../../../module/ft_motion.h"
+
+void GcodeSuite::M493_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F("Fixed-Time Motion"));
+  SERIAL_ECHOLNPGM("  M493 S", int(ftMotion.active));
+}
+
+/**
+ * M493: Get or Set the Fixed-Time Motion mode
+ *  S<mode>   0 = Standard stepper ISR, 1 = Fixed-Time Motion
+ *
+ * The mode changes once the queued moves are done.
+ * With no parameters, report the mode and its step rate limit.
+ */
+void GcodeSuite::M493() {
+  if (parser.seenval('S')) {
+    ftMotion.set_active(parser.value_bool());
+    return;
+  }
+
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("Fixed-Time Motion ");
+  if (ftMotion.active)
+    SERIAL_ECHOLNPGM("on. Frames:", FTM_FRAME_RATE, "Hz Max rate:", uint32_t(FTM_FRAME_RATE) * (FTM_STEPS_PER_FRAME), " steps/s");
+  else
+    SERIAL_ECHOLNPGM("off");
+}
+
+#endif // FT_MOTION
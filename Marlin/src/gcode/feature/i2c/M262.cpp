@@ -0,0 +1,43 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(I2C_ASYNC_QUEUE)
+
+#include "../../gcode.h"
+#include "../../../HAL/shared/i2c_async.h"
+
+/**
+ * M262: Report I2C queue statistics
+ *
+ *  Jobs completed, queue depth, dropped jobs, errors and bus recoveries,
+ *  bus utilization and queue latency since startup or the last reset.
+ *
+ *  R : Reset the statistics after the report
+ */
+void GcodeSuite::M262() {
+  i2c_async.report();
+  if (parser.seen_test('R')) i2c_async.reset_stats();
+}
+
+#endif // I2C_ASYNC_QUEUE
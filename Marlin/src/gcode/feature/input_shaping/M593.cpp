@@ -0,0 +1,113 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if HAS_SHAPING
+
+#include "../../gcode.h"
+#include "../../../module/stepper.h"
+
+static void say_shaping(const AxisEnum axis) {
+  SERIAL_ECHO_START();
+  SERIAL_CHAR(AXIS_CHAR(axis));
+  SERIAL_ECHOPGM(" input shaping ");
+  if (stepper.get_shaping_frequency(axis))
+    SERIAL_ECHOLNPGM("F:", stepper.get_shaping_frequency(axis), "Hz D:", stepper.get_shaping_damping_ratio(axis), " T:", stepper.get_shaping_type(axis));
+  else
+    SERIAL_ECHOLNPGM("off");
+}
+
+void GcodeSuite::M593_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F("Input Shaping"));
+  #if ENABLED(INPUT_SHAPING_X)
+    SERIAL_ECHOLNPGM("  M593 X"
+      " F", stepper.get_shaping_frequency(X_AXIS),
+      " D", stepper.get_shaping_damping_ratio(X_AXIS),
+      " T", stepper.get_shaping_type(X_AXIS)
+    );
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    TERN_(INPUT_SHAPING_X, report_echo_start(forReplay));
+    SERIAL_ECHOLNPGM("  M593 Y"
+      " F", stepper.get_shaping_frequency(Y_AXIS),
+      " D", stepper.get_shaping_damping_ratio(Y_AXIS),
+      " T", stepper.get_shaping_type(Y_AXIS)
+    );
+  #endif
+}
+
+/**
+ * M593: Get or Set Input Shaping Parameters
+ *  X         Set the given parameters only for the X axis.
+ *  Y         Set the given parameters only for the Y axis.
+ *            With neither X nor Y, set both shaped axes.
+ *  F<hz>     Resonant frequency. 0 to disable shaping.
+ *  D<zeta>   Damping ratio, 0 to 0.99
+ *  T<type>   Shaper type: 0=ZV 1=ZVD 2=MZV 3=EI
+ *
+ * With no parameters, report the current settings.
+ */
+void GcodeSuite::M593() {
+  if (!parser.seen("FDT")) {
+    TERN_(INPUT_SHAPING_X, say_shaping(X_AXIS));
+    TERN_(INPUT_SHAPING_Y, say_shaping(Y_AXIS));
+    return;
+  }
+
+  const bool seen_x = TERN0(INPUT_SHAPING_X, parser.seen_test('X')),
+             seen_y = TERN0(INPUT_SHAPING_Y, parser.seen_test('Y')),
+             for_x = TERN0(INPUT_SHAPING_X, seen_x || !seen_y),
+             for_y = TERN0(INPUT_SHAPING_Y, seen_y || !seen_x);
+
+  if (parser.seenval('D')) {
+    const float zeta = parser.value_float();
+    if (WITHIN(zeta, 0, 0.99f)) {
+      if (for_x) stepper.set_shaping_damping_ratio(X_AXIS, zeta);
+      if (for_y) stepper.set_shaping_damping_ratio(Y_AXIS, zeta);
+    }
+    else
+      SERIAL_ECHO_MSG("?Damping ratio (D) value out of range (0-0.99)");
+  }
+
+  if (parser.seenval('T')) {
+    const uint8_t type = parser.value_byte();
+    if (type <= SHAPER_EI) {
+      if (for_x) stepper.set_shaping_type(X_AXIS, ShaperType(type));
+      if (for_y) stepper.set_shaping_type(Y_AXIS, ShaperType(type));
+    }
+    else
+      SERIAL_ECHO_MSG("?Shaper type (T) value out of range (0-3)");
+  }
+
+  if (parser.seenval('F')) {
+    const float freq = parser.value_float();
+    if (freq == 0 || freq >= (SHAPING_MIN_FREQ)) {
+      if (for_x) stepper.set_shaping_frequency(X_AXIS, freq);
+      if (for_y) stepper.set_shaping_frequency(Y_AXIS, freq);
+    }
+    else
+      SERIAL_ECHO_MSG("?Frequency (F) must be 0 or at least ", SHAPING_MIN_FREQ, "Hz");
+  }
+}
+
+#endif // HAS_SHAPING
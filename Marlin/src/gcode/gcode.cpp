@@ -451,6 +451,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 61: G61(); break;                                    // G61:  Apply/restore saved coordinates.
       #endif
 
+      #if ENABLED(PATH_BLENDING)
+        case 64: G64(); break;                                    // G64: Blend the corners between line moves
+      #endif
+
       #if BOTH(PTC_PROBE, PTC_BED)
         case 76: G76(); break;                                    // G76: Calibrate first layer compensation values
       #endif
@@ -627,6 +631,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 193: M193(); break;                                  // M193: Wait for cooler temperature to reach target
       #endif
 
+      #if ENABLED(BED_ZONE_FOOTPRINT)
+        case 196: M196(); break;                                  // M196: Set print footprint for bed zones
+      #endif
+
       #if ENABLED(AUTO_REPORT_POSITION)
         case 154: M154(); break;                                  // M154: Set position auto-report interval
       #endif
@@ -774,6 +782,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 304: M304(); break;                                  // M304: Set bed PID parameters
       #endif
 
+      #if ENABLED(BED_ZONE_COUPLING)
+        case 307: M307(); break;                                  // M307: Set bed zone thermal coupling
+      #endif
+
+      #if ADS1115_BED_READING
+        case 308: M308(); break;                                  // M308: Set bed ADC rate and filters
+      #endif
+
       #if ENABLED(PIDTEMPCHAMBER)
         case 309: M309(); break;                                  // M309: Set chamber PID parameters
       #endif
@@ -795,6 +811,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 261: M261(); break;                                  // M261: Request data from an i2c slave
       #endif
 
+      #if ENABLED(I2C_ASYNC_QUEUE)
+        case 262: M262(); break;                                  // M262: Report I2C queue statistics
+      #endif
+
       #if ENABLED(PREVENT_COLD_EXTRUSION)
         case 302: M302(); break;                                  // M302: Allow cold extrudes (set the minimum extrude temperature)
       #endif
@@ -882,6 +902,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 486: M486(); break;                                  // M486: Identify and cancel objects
       #endif
 
+      #if ENABLED(FT_MOTION)
+        case 493: M493(); break;                                  // M493: Fixed-Time Motion
+      #endif
+
       case 500: M500(); break;                                    // M500: Store settings in EEPROM
       case 501: M501(); break;                                    // M501: Read settings from EEPROM
       case 502: M502(); break;                                    // M502: Revert to default settings
@@ -920,6 +944,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if HAS_SHAPING
+        case 593: M593(); break;                                  // M593: Input Shaping
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -1131,7 +1159,14 @@ void GcodeSuite::process_next_command() {
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
-    SERIAL_ECHOLN(command.buffer);
+    #if ENABLED(BINARY_MOTION_COMMANDS)
+      if (command.tokenized()) {
+        SERIAL_CHAR(command.record.letter);
+        SERIAL_ECHOLN(command.record.codenum);
+      }
+      else
+    #endif
+        SERIAL_ECHOLN(command.buffer);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPGM("slot:", queue.ring_buffer.index_r);
       M100_dump_routine(F("   Command Queue:"), (const char*)&queue.ring_buffer, sizeof(queue.ring_buffer));
@@ -1139,7 +1174,12 @@ void GcodeSuite::process_next_command() {
   }
 
   // Parse the next command in the queue
-  parser.parse(command.buffer);
+  #if HAS_GCODE_RECORDS
+    if (command.has_record)
+      parser.load(command.record, TERN(PARSED_COMMAND_QUEUE, command.buffer + command.record.command, nullptr));
+    else
+  #endif
+      parser.parse(command.buffer);
   process_parsed_command();
 }
 
@@ -1155,6 +1195,7 @@ void GcodeSuite::process_next_command() {
 void GcodeSuite::process_subcommands_now(FSTR_P fgcode) {
   PGM_P pgcode = FTOP(fgcode);
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  TERN_(HAS_GCODE_RECORDS, const GCodeRecord * const saved_record = parser.record);
   for (;;) {
     PGM_P const delim = strchr_P(pgcode, '\n');       // Get address of next newline
     const size_t len = delim ? delim - pgcode : strlen_P(pgcode); // Get the command length
@@ -1166,13 +1207,19 @@ void GcodeSuite::process_subcommands_now(FSTR_P fgcode) {
     if (!delim) break;                                // Last command?
     pgcode = delim + 1;                               // Get the next command
   }
-  parser.parse(saved_cmd);                            // Restore the parser state
+  #if HAS_GCODE_RECORDS
+    if (saved_record)
+      parser.load(*saved_record, saved_cmd);          // Restore the parser state
+    else
+  #endif
+      parser.parse(saved_cmd);                        // Restore the parser state
 }
 
 #pragma GCC diagnostic pop
 
 void GcodeSuite::process_subcommands_now(char * gcode) {
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  TERN_(HAS_GCODE_RECORDS, const GCodeRecord * const saved_record = parser.record);
   for (;;) {
     char * const delim = strchr(gcode, '\n');         // Get address of next newline
     if (delim) *delim = '\0';                         // Replace with nul
@@ -1182,7 +1229,12 @@ void GcodeSuite::process_subcommands_now(char * gcode) {
     *delim = '\n';                                    // Put back the newline
     gcode = delim + 1;                                // Get the next command
   }
-  parser.parse(saved_cmd);                            // Restore the parser state
+  #if HAS_GCODE_RECORDS
+    if (saved_record)
+      parser.load(*saved_record, saved_cmd);          // Restore the parser state
+    else
+  #endif
+      parser.parse(saved_cmd);                        // Restore the parser state
 }
 
 #if ENABLED(HOST_KEEPALIVE_FEATURE)
@@ -66,6 +66,7 @@
  * G42  - Coordinated move to a mesh point (Requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BLINEAR, or AUTO_BED_LEVELING_UBL)
  * G60  - Save current position. (Requires SAVED_POSITIONS)
  * G61  - Apply/restore saved coordinates. (Requires SAVED_POSITIONS)
+ * G64  - Blend the corners between line moves: P<tolerance> (Requires PATH_BLENDING)
  * G76  - Calibrate first layer temperature offsets. (Requires PTC_PROBE and PTC_BED)
  * G80  - Cancel current motion mode (Requires GCODE_MOTION_MODES)
  * G90  - Use Absolute Coordinates
@@ -142,6 +143,7 @@
  *        If AUTOTEMP is enabled, S<mintemp> B<maxtemp> F<factor>. Exit autotemp by any M109 without F
  *
  * M110 - Set the current line number. (Used by host printing)
+ *        W<lines> sets a window of lines sent ahead. (Requires SERIAL_ACK_WINDOW)
  * M111 - Set debug flags: "M111 S<flagbits>". See flag bits defined in enum.h.
  * M112 - Full Shutdown.
  *
@@ -172,6 +174,7 @@
  * M150 - Set Status LED Color as R<red> U<green> B<blue> W<white> P<bright>. Values 0-255. (Requires BLINKM, RGB_LED, RGBW_LED, NEOPIXEL_LED, PCA9533, or PCA9632).
  * M154 - Auto-report position with interval of S<seconds>. (Requires AUTO_REPORT_POSITION)
  * M155 - Auto-report temperatures with interval of S<seconds>. (Requires AUTO_REPORT_TEMPERATURES)
+ *        Stream the bed zones at B<hz>, as text or F1 binary frames on serial port P. (Requires BED_TELEMETRY)
  * M163 - Set a single proportion for a mixing extruder. (Requires MIXING_EXTRUDER)
  * M164 - Commit the mix and save to a virtual tool (current, or as specified by 'S'). (Requires MIXING_EXTRUDER)
  * M165 - Set the mix for the mixing extruder (and current virtual tool) with parameters ABCDHI. (Requires MIXING_EXTRUDER and DIRECT_MIXING_IN_G1)
@@ -179,6 +182,7 @@
  * M190 - Set bed target temperature and wait. R<temp> Set target temperature and wait. S<temp> Set, but only wait when heating. (Requires TEMP_SENSOR_BED0)
  * M192 - Wait for probe to reach target temperature. (Requires TEMP_SENSOR_PROBE)
  * M193 - R<temp> Wait for cooler to reach target temp. ** Wait for cooling. **
+ * M196 - Set the print footprint for bed zone selection X<min> Y<min> I<max> J<max>. A to add, R to reset. (Requires BED_ZONE_FOOTPRINT)
  * M200 - Set filament diameter, D<diameter>, setting E axis units to cubic. (Use S0 to revert to linear units.)
  * M201 - Set max acceleration in units/s^2 for print moves: "M201 X<accel> Y<accel> Z<accel> E<accel>"
  * M202 - Set max acceleration in units/s^2 for travel moves: "M202 X<accel> Y<accel> Z<accel> E<accel>" ** UNUSED IN MARLIN! **
@@ -206,6 +210,7 @@
  * M256 - Set LCD brightness: "M256 B<brightness>" (0-255). (Requires an LCD with brightness control)
  * M260 - i2c Send Data (Requires EXPERIMENTAL_I2CBUS)
  * M261 - i2c Request Data (Requires EXPERIMENTAL_I2CBUS)
+ * M262 - Report I2C queue statistics. R to reset. (Requires I2C_ASYNC_QUEUE)
  * M280 - Set servo position absolute: "M280 P<index> S<angle|µs>". (Requires servos)
  * M281 - Set servo min|max position: "M281 P<index> L<min> U<max>". (Requires EDITABLE_SERVO_ANGLES)
  * M282 - Detach servo: "M282 P<index>". (Requires SERVO_DETACH_GCODE)
@@ -217,6 +222,8 @@
  * M304 - Set bed PID parameters P I and D. (Requires PIDTEMPBED)
  * M305 - Set user thermistor parameters R T and P. (Requires TEMP_SENSOR_x 1000)
  * M306 - MPC autotune. (Requires MPCTEMP)
+ * M307 - Set bed zone thermal coupling B<zone> C<zone> S<gain> and self gain B<zone> P<gain>. (Requires BED_ZONE_COUPLING)
+ * M308 - Set bed ADC rate R<sps>, median samples S<count> and smoothing F<shift>. (Requires ADS1115_BED_READING)
  * M309 - Set chamber PID parameters P I and D. (Requires PIDTEMPCHAMBER)
  * M350 - Set microstepping mode. (Requires digital microstepping pins.)
  * M351 - Toggle MS1 MS2 pins directly. (Requires digital microstepping pins.)
@@ -242,6 +249,7 @@
  * M428 - Set the home_offset based on the current_position. Nearest edge applies. (Disabled by NO_WORKSPACE_OFFSETS or DELTA)
  * M430 - Read the system current, voltage, and power (Requires POWER_MONITOR_CURRENT, POWER_MONITOR_VOLTAGE, or POWER_MONITOR_FIXED_VOLTAGE)
  * M486 - Identify and cancel objects. (Requires CANCEL_OBJECTS)
+ * M493 - Get or set the Fixed-Time Motion mode: "M493 S<0|1>". (Requires FT_MOTION)
  * M500 - Store parameters in EEPROM. (Requires EEPROM_SETTINGS)
  * M501 - Restore parameters from EEPROM. (Requires EEPROM_SETTINGS)
  * M502 - Revert to the default "factory settings". ** Does not write them to EEPROM! **
@@ -257,6 +265,7 @@
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
  * M575 - Change the serial baud rate. (Requires BAUD_RATE_GCODE)
+ * M593 - Get or set input shaping parameters. (Requires INPUT_SHAPING_X or INPUT_SHAPING_Y)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -590,6 +599,8 @@ private:
     static void G61();
   #endif
 
+  TERN_(PATH_BLENDING, static void G64());
+
   #if ENABLED(GCODE_MOTION_MODES)
     static void G80();
   #endif
@@ -787,6 +798,10 @@ private:
     static void M193();
   #endif
 
+  #if ENABLED(BED_ZONE_FOOTPRINT)
+    static void M196();
+  #endif
+
   #if HAS_PREHEAT
     static void M145();
     static void M145_report(const bool forReplay=true);
@@ -901,6 +916,10 @@ private:
     static void M261();
   #endif
 
+  #if ENABLED(I2C_ASYNC_QUEUE)
+    static void M262();
+  #endif
+
   #if HAS_SERVOS
     static void M280();
     #if ENABLED(EDITABLE_SERVO_ANGLES)
@@ -947,6 +966,16 @@ private:
     static void M306_report(const bool forReplay=true);
   #endif
 
+  #if ENABLED(BED_ZONE_COUPLING)
+    static void M307();
+    static void M307_report(const bool forReplay=true);
+  #endif
+
+  #if ADS1115_BED_READING
+    static void M308();
+    static void M308_report(const bool forReplay=true);
+  #endif
+
   #if ENABLED(PIDTEMPCHAMBER)
     static void M309();
     static void M309_report(const bool forReplay=true);
@@ -1029,6 +1058,11 @@ private:
     static void M486();
   #endif
 
+  #if ENABLED(FT_MOTION)
+    static void M493();
+    static void M493_report(const bool forReplay=true);
+  #endif
+
   static void M500();
   static void M501();
   static void M502();
@@ -1075,6 +1109,11 @@ private:
     static void M575();
   #endif
 
+  #if HAS_SHAPING
+    static void M593();
+    static void M593_report(const bool forReplay=true);
+  #endif
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
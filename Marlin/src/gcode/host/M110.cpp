@@ -25,10 +25,22 @@
 
 /**
  * M110: Set Current Line Number
+ *
+ *  N<line>  - The number of the current line
+ *
+ * With SERIAL_ACK_WINDOW:
+ *  W<lines> - Lines the host may send ahead without an "ok" for each, up to ACK_WINDOW_MAX.
+ *             Acknowledged by "ACK_WINDOW:<lines>". Omit, or W0, to go back to one "ok" per line.
+ *             In a window:
+ *              - Every line must have a line number and checksum.
+ *              - "ok N<line>" acknowledges all lines up to <line>. Other "ok" replies aren't acks.
+ *              - "Resend: <line>" asks for that line only. Lines after it are kept.
+ *              - The host resends unacknowledged lines after a timeout.
+ *             A serial M110 takes effect on arrival, so its line number is set already.
  */
 void GcodeSuite::M110() {
 
-  if (parser.seenval('N'))
+  if (parser.seenval('N') && !TERN0(SERIAL_ACK_WINDOW, queue.ack_window()))
     queue.set_current_line_number(parser.value_long());
 
 }
@@ -188,6 +188,10 @@
     SERIAL_ECHOPGM("Diff:   ");
     report_all_axis_pos(diff);
 
+    #if ENABLED(COALESCE_SEGMENTS)
+      SERIAL_ECHOLNPGM("Coalesced: ", planner.coalesce_moves, " moves in ", planner.coalesce_blocks, " blocks");
+    #endif
+
     TERN_(FULL_REPORT_TO_HOST_FEATURE, report_current_grblstate_moving());
   }
 
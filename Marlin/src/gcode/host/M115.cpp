@@ -87,9 +87,15 @@ void GcodeSuite::M115() {
     // SERIAL_XON_XOFF
     cap_line(F("SERIAL_XON_XOFF"), ENABLED(SERIAL_XON_XOFF));
 
+    // ACK_WINDOW (M110 W)
+    cap_line(F("ACK_WINDOW"), ENABLED(SERIAL_ACK_WINDOW));
+
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(F("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER)); // TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
+    // BINARY_MOTION_COMMANDS (binary stream protocol 2)
+    cap_line(F("BINARY_MOTION_COMMANDS"), ENABLED(BINARY_MOTION_COMMANDS));
+
     // EEPROM (M500, M501)
     cap_line(F("EEPROM"), ENABLED(EEPROM_SETTINGS));
 
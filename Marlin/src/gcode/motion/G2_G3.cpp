@@ -29,6 +29,10 @@
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(FTM_CURVE_BLOCKS)
+  #include "../../module/ft_motion.h"
+#endif
+
 #if ENABLED(DELTA)
   #include "../../module/delta.h"
 #elif ENABLED(SCARA)
@@ -199,6 +203,22 @@ void plan_arc(
     hints.inv_duration = (scaled_fr_mm_s / flat_mm) * segments;
   #endif
 
+  #if ENABLED(FTM_CURVE_BLOCKS)
+    // Fixed-Time Motion traces the whole arc from one planner block
+    ft_curve_t curve;
+    bool one_block = ftMotion.curves_ok();
+    if (one_block) {
+      curve.set_arc(axis_p, axis_q, offset, angular_travel, HYPOT(rt_X, rt_Y));
+      one_block = curve.within_limits(current_position);
+    }
+    if (one_block) {
+      hints.curve = &curve;
+      hints.millimeters = TERN(HAS_Z_AXIS, TERN(AUTO_BED_LEVELING_UBL, curve.planar_mm, HYPOT(curve.planar_mm, travel_L)), curve.planar_mm);
+    }
+  #else
+    constexpr bool one_block = false;
+  #endif
+
   /**
    * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
    * and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
@@ -229,7 +249,7 @@ void plan_arc(
   xyze_pos_t raw;
 
   // do not calculate rotation parameters for trivial single-segment arcs
-  if (segments > 1) {
+  if (segments > 1 && !one_block) {
     // Vector rotation matrix values
     const float theta_per_segment = angular_travel / segments,
                 sq_theta_per_segment = sq(theta_per_segment),
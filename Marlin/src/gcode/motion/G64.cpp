@@ -0,0 +1,40 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PATH_BLENDING)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+
+/**
+ * G64: Blend the corners between line moves
+ *
+ *   P<linear> - Farthest the path may pass from each corner. Default BLEND_TOLERANCE.
+ *               P0 follows the exact path.
+ */
+void GcodeSuite::G64() {
+  planner.set_blend_tolerance(parser.seenval('P') ? parser.value_linear_units() : float(BLEND_TOLERANCE));
+}
+
+#endif // PATH_BLENDING
@@ -51,6 +51,11 @@ uint16_t GCodeParser::codenum;
   uint8_t GCodeParser::subcode;
 #endif
 
+#if HAS_GCODE_RECORDS
+  const GCodeRecord *GCodeParser::record;
+  uint8_t GCodeParser::value_index;
+#endif
+
 #if ENABLED(GCODE_MOTION_MODES)
   int16_t GCodeParser::motion_mode_codenum = -1;
   #if USE_GCODE_SUBCODES
@@ -80,6 +85,7 @@ void GCodeParser::reset() {
   command_letter = '?';                 // No command letter
   codenum = 0;                          // No command code
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
+  TERN_(HAS_GCODE_RECORDS, record = nullptr); // Not from a record
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
@@ -363,6 +369,255 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if HAS_GCODE_RECORDS
+
+  /**
+   * Populate the command line state from a record. The record and
+   * its text must stay in place until the command is done.
+   */
+  void GCodeParser::load(const GCodeRecord &rec, char * const cmd) {
+    static char no_text[] = "";
+
+    reset();
+    record = &rec;
+    command_ptr = cmd ?: no_text;
+    if (rec.string_arg) string_arg = cmd + rec.string_arg;
+    command_letter = rec.letter;
+    codenum = rec.codenum;
+    TERN_(USE_GCODE_SUBCODES, subcode = rec.subcode);
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (rec.letter == 'G'
+        && (codenum <= TERN(ARC_SUPPORT, 3, 1) || TERN0(BEZIER_CURVE_SUPPORT, codenum == 5) || TERN0(G38_PROBE_TARGET, codenum == 38))
+      ) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+
+    codebits = rec.codebits;
+    ZERO(param);
+    LOOP_L_N(i, rec.count) param[rec.param[i]] = i + 1;
+  }
+
+#endif
+
+/**
+ * Read the digits of a decimal number into a mantissa and a count of decimal
+ * places, without trailing zeros after the point. Reading stops at the first
+ * character that can't continue the number, so an 'E' ends it. Return false
+ * for over 19 significant digits, or for a number strtof would read as hex.
+ */
+static bool read_decimal(const char *p, uint64_t &mantissa, uint8_t &decimals, bool &neg) {
+  neg = (*p == '-');
+  if (neg || *p == '+') p++;
+  uint64_t m = 0;
+  uint8_t digits = 0, places = 0, zeros = 0, sig = 0;  // 'zeros' are held back until a non-zero digit
+  bool point = false;
+  for (;; ++p) {
+    const char c = *p;
+    if (NUMERIC(c)) {
+      if (++digits > 100) return false;                 // Far beyond any float
+      if (point) places++;
+      if (c == '0') { zeros++; continue; }
+      if (m) sig += zeros;                              // Leading zeros aren't significant
+      if (++sig > 19) return false;
+      for (; zeros; --zeros) m *= 10;
+      m = m * 10 + (c - '0');
+    }
+    else if (c == '.' && !point)
+      point = true;
+    else
+      break;
+  }
+  if (!digits || *p == 'x' || *p == 'X') return false;
+
+  // Trailing zeros after the point are dropped, and those before it applied
+  const uint8_t fraction_zeros = _MIN(zeros, places);
+  places -= fraction_zeros;
+  zeros -= fraction_zeros;
+  if (m) {
+    if (sig + zeros > 19) return false;
+    for (; zeros; --zeros) m *= 10;
+  }
+  else
+    places = 0;
+
+  mantissa = m;
+  decimals = places;
+  return true;
+}
+
+/**
+ * Get the decimal fixed-point form of a number, if it gives exactly what
+ * strtof and strtol would get from the text. Negative zero is left to strtof.
+ */
+bool GCodeParser::fixed_point(const char * const p, int32_t &mantissa, uint8_t &decimals) {
+  uint64_t m;
+  bool neg;
+  if (!read_decimal(p, m, decimals, neg) || (neg && !m) || decimals > GCODE_FIXED_DECIMALS) return false;
+  // A float holds the mantissa exactly below 2^24, so one divide rounds as strtof
+  if (m >= (decimals ? _BV32(24) : _BV32(31))) return false;
+  mantissa = neg ? -int32_t(m) : int32_t(m);
+  return true;
+}
+
+/**
+ * Read a number as strtof would, but only up to an 'E', since that's a
+ * parameter letter, and without regard to the locale. Rounding is exact:
+ *  - Whole numbers and mantissas under 2^24 convert or divide once in float.
+ *  - Up to 2^53 a double divide is rounded once more to float. That can only
+ *    differ from rounding the exact value when the double is a float tie.
+ *    (Not on AVR, where a double is a float.)
+ *  - Anything else (ties, over 19 digits, hex, subnormals) goes to strtof.
+ */
+float GCodeParser::parse_float(char * const str) {
+  uint64_t m;
+  uint8_t d;
+  bool neg;
+  if (read_decimal(str, m, d, neg)) {
+    static constexpr float pow10f[] = { 1, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+    #if __DBL_MANT_DIG__ >= 53
+      static constexpr double pow10d[] = { 1, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                           1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    #endif
+    bool exact = true;
+    float f = 0;
+    if (!d)
+      f = float(m);
+    else if (m < _BV32(24) && d < COUNT(pow10f))
+      f = float(uint32_t(m)) / pow10f[d];
+    #if __DBL_MANT_DIG__ >= 53
+      else if (m < (1ULL << 53) && d < COUNT(pow10d)) {
+        const double q = double(m) / pow10d[d];
+        uint64_t bits;
+        memcpy(&bits, &q, sizeof(bits));
+        exact = q >= double(__FLT_MIN__) && (bits & 0x1FFFFFFFULL) != 0x10000000ULL;
+        f = float(q);
+      }
+    #endif
+    else
+      exact = false;
+    if (exact) return neg ? -f : f;
+  }
+
+  // Cut the text at an 'E' for strtof
+  for (char *e = str; ; ++e) {
+    const char c = *e;
+    if (c == '\0' || c == ' ') break;
+    if (c == 'E' || c == 'e') {
+      *e = '\0';
+      const float ret = strtof(str, nullptr);
+      *e = c;
+      return ret;
+    }
+  }
+  return strtof(str, nullptr);
+}
+
+/**
+ * The value times mul/div, rounded once from the decimal value when the
+ * fixed-point numbers are exact floats. Used for unit and feedrate scaling.
+ */
+float GCodeParser::value_scaled(const uint16_t mul, const uint16_t div) {
+  static constexpr uint32_t pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+  int32_t m;
+  uint8_t d;
+  bool fixed = false;
+  if (value_ptr) {
+    #if HAS_GCODE_RECORDS
+      if (record_value()) {
+        const uint8_t i = value_index - 1;
+        m = record->value[i];
+        d = record->decimals[i];
+        fixed = true;
+      }
+      else
+    #endif
+        fixed = fixed_point(value_ptr, m, d);
+  }
+  if (fixed) {
+    const int64_t n = int64_t(m) * mul;
+    const uint64_t den = uint64_t(pow10[d]) * div;
+    if (ABS(n) < int64_t(_BV32(24)) && den < _BV32(24)) return float(int32_t(n)) / float(uint32_t(den));
+  }
+  return value_float() * mul / div;
+}
+
+#if ENABLED(PARSED_COMMAND_QUEUE)
+
+  /**
+   * Parse a command as it goes into the queue, so it needn't be parsed
+   * again when it runs. The queue may be filled from idle() while a command
+   * is running, so the state of that command is put back afterward.
+   * Return false if the command must be parsed from its text when it runs.
+   */
+  bool GCodeParser::make_record(char * const text, GCodeRecord &rec) {
+    char * const saved_ptr = command_ptr, * const saved_arg = string_arg, * const saved_value = value_ptr;
+    const char saved_letter = command_letter;
+    const uint16_t saved_codenum = codenum;
+    TERN_(USE_GCODE_SUBCODES, const uint8_t saved_subcode = subcode);
+    const GCodeRecord * const saved_record = record;
+    const uint8_t saved_index = value_index;
+    const uint32_t saved_codebits = codebits;
+    uint8_t saved_param[COUNT(param)];
+    COPY(saved_param, param);
+    #if ENABLED(GCODE_MOTION_MODES)
+      const int16_t saved_mode = motion_mode_codenum;
+      TERN_(USE_GCODE_SUBCODES, const uint8_t saved_mode_subcode = motion_mode_subcode);
+    #endif
+
+    parse(text);
+
+    // Only G, M, and T commands. Others depend on the motion mode when they run.
+    bool ok = false;
+    switch (*command_ptr) {
+      case 'G': case 'M': case 'T':
+      TERN_(GCODE_CASE_INSENSITIVE, case 'g': case 'm': case 't':)
+        ok = (command_letter != '?');
+    }
+
+    if (ok) {
+      rec.letter = command_letter;
+      rec.codenum = codenum;
+      TERN_(USE_GCODE_SUBCODES, rec.subcode = subcode);
+      rec.command = command_ptr - text;
+      rec.string_arg = string_arg ? string_arg - command_ptr : 0;
+      rec.codebits = codebits;
+      rec.count = 0;
+      uint32_t bits = codebits;
+      for (uint8_t ind = 0; bits; ++ind, bits >>= 1) {
+        if (!(bits & 1) || !param[ind]) continue;
+        char * const ptr = command_ptr + param[ind];
+        if (!valid_number(ptr)) continue;
+        if (rec.count >= GCODE_RECORD_VALUES) { ok = false; break; }
+        const uint8_t i = rec.count++;
+        rec.param[i] = ind;
+        rec.offset[i] = param[ind];
+        if (!fixed_point(ptr, rec.value[i], rec.decimals[i])) rec.decimals[i] = GCODE_RECORD_TEXT;
+      }
+    }
+
+    command_ptr = saved_ptr;
+    string_arg = saved_arg;
+    value_ptr = saved_value;
+    command_letter = saved_letter;
+    codenum = saved_codenum;
+    TERN_(USE_GCODE_SUBCODES, subcode = saved_subcode);
+    record = saved_record;
+    value_index = saved_index;
+    codebits = saved_codebits;
+    COPY(param, saved_param);
+    #if ENABLED(GCODE_MOTION_MODES)
+      motion_mode_codenum = saved_mode;
+      TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = saved_mode_subcode);
+    #endif
+
+    return ok;
+  }
+
+#endif
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
@@ -42,6 +42,38 @@
   typedef enum : uint8_t { LINEARUNIT_MM, LINEARUNIT_INCH } LinearUnit;
 #endif
 
+#define GCODE_FIXED_DECIMALS 7              // Most decimal places of a fixed-point value
+
+#if HAS_GCODE_RECORDS
+
+  #define GCODE_RECORD_VALUES 12            // Most parameters with a value in a record
+  #define GCODE_RECORD_DECIMALS GCODE_FIXED_DECIMALS
+  #define GCODE_RECORD_TEXT 0xFF            // Decimals of a value that must be read from the text
+
+  /**
+   * A command parsed before it runs, kept in the command queue along with its
+   * text, or in place of the text when it arrived pre-tokenized. Values are
+   * decimal fixed-point, so a record gives the same floats as the text it was
+   * made from. Offsets are from the command, as in GCodeParser::param.
+   */
+  struct GCodeRecord {
+    char letter;                            // G, M, or T
+    uint8_t count;                          // Number of values
+    uint16_t codenum;
+    #if USE_GCODE_SUBCODES
+      uint8_t subcode;
+    #endif
+    uint8_t command,                        // Offset of the command in the text
+            string_arg;                     // Offset of the string argument, 0 for none
+    uint32_t codebits;                      // Parameters seen, with or without a value
+    int32_t value[GCODE_RECORD_VALUES];     // Value mantissas
+    uint8_t decimals[GCODE_RECORD_VALUES],  // Value decimal places, or GCODE_RECORD_TEXT
+            param[GCODE_RECORD_VALUES],     // Value letters, 0 for 'A'
+            offset[GCODE_RECORD_VALUES];    // Value offsets, 0 with no text
+  };
+
+#endif
+
 /**
  * GCode parser
  *
@@ -58,10 +90,14 @@ class GCodeParser {
 
 private:
   static char *value_ptr;           // Set by seen, used to fetch the value
+  #if HAS_GCODE_RECORDS
+    static uint8_t value_index;     // Set by seen, the record value number plus 1
+  #endif
 
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;       // Parameters pre-scanned
     static uint8_t param[26];       // For A-Z, offsets into command args
+                                    // or the value number plus 1 for a record
   #else
     static char *command_args;      // Args start here, for slow scan
   #endif
@@ -89,6 +125,10 @@ public:
     static uint8_t subcode;               // .1
   #endif
 
+  #if HAS_GCODE_RECORDS
+    static const GCodeRecord *record;     // The record of the command, if any
+  #endif
+
   #if ENABLED(GCODE_MOTION_MODES)
     static int16_t motion_mode_codenum;
     #if USE_GCODE_SUBCODES
@@ -147,6 +187,13 @@ public:
       if (ind >= COUNT(param)) return false; // Only A-Z
       const bool b = TEST32(codebits, ind);
       if (b) {
+        #if HAS_GCODE_RECORDS
+          if (record) {
+            value_index = param[ind];
+            value_ptr = value_index ? command_ptr + record->offset[value_index - 1] : nullptr;
+            return b;
+          }
+        #endif
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
           value_ptr = valid_number(ptr) ? ptr : nullptr;
@@ -237,6 +284,16 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if HAS_GCODE_RECORDS
+    // Populate all fields from a record, with the command text at 'cmd', or none
+    static void load(const GCodeRecord &rec, char * const cmd);
+  #endif
+
+  #if ENABLED(PARSED_COMMAND_QUEUE)
+    // Parse a queued command into a record, leaving the current command as it was
+    static bool make_record(char * const text, GCodeRecord &rec);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -254,29 +311,52 @@ public:
   // The value as a string
   static char* value_string() { return value_ptr; }
 
-  // Float removes 'E' to prevent scientific notation interpretation
-  static float value_float() {
-    if (value_ptr) {
-      char *e = value_ptr;
-      for (;;) {
-        const char c = *e;
-        if (c == '\0' || c == ' ') break;
-        if (c == 'E' || c == 'e') {
-          *e = '\0';
-          const float ret = strtof(value_ptr, nullptr);
-          *e = c;
-          return ret;
-        }
-        ++e;
-      }
-      return strtof(value_ptr, nullptr);
+  #if HAS_GCODE_RECORDS
+    // The value was seen in a record that holds it
+    static bool record_value() { return record && value_ptr && record->decimals[value_index - 1] != GCODE_RECORD_TEXT; }
+    // The value from a record. A float divide gives the same result as strtof.
+    static float record_float() {
+      static constexpr float scale[] = { 1, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f };
+      const uint8_t i = value_index - 1;
+      return float(record->value[i]) / scale[record->decimals[i]];
     }
-    return 0;
+    // Whole part of the value from a record, as strtol
+    static int32_t record_long() {
+      static constexpr int32_t scale[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+      const uint8_t i = value_index - 1;
+      return record->value[i] / scale[record->decimals[i]];
+    }
+  #endif
+
+  // Read a number as strtof would, up to an 'E' to prevent scientific notation interpretation
+  static float parse_float(char * const str);
+
+  // Get the fixed-point form of a number, if it's exact
+  static bool fixed_point(const char * const p, int32_t &mantissa, uint8_t &decimals);
+
+  static float value_float() {
+    #if HAS_GCODE_RECORDS
+      if (record_value()) return record_float();
+    #endif
+    return value_ptr ? parse_float(value_ptr) : 0;
   }
 
+  // The value times mul/div, with one rounding
+  static float value_scaled(const uint16_t mul, const uint16_t div);
+
   // Code value as a long or ulong
-  static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  static int32_t value_long() {
+    #if HAS_GCODE_RECORDS
+      if (record_value()) return record_long();
+    #endif
+    return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L;
+  }
+  static uint32_t value_ulong() {
+    #if HAS_GCODE_RECORDS
+      if (record_value()) return uint32_t(record_long());
+    #endif
+    return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL;
+  }
 
   // Code value for use as time
   static millis_t value_millis() { return value_ulong(); }
@@ -340,7 +420,12 @@ public:
   #define LINEAR_UNIT(V)     parser.mm_to_linear_unit(V)
   #define VOLUMETRIC_UNIT(V) parser.mm_to_volumetric_unit(V)
 
-  static float value_linear_units()                      { return linear_value_to_mm(value_float()); }
+  static float value_linear_units() {
+    #if ENABLED(INCH_MODE_SUPPORT)
+      if (using_inch_units()) return value_scaled(254, 10); // 25.4mm per inch
+    #endif
+    return value_float();
+  }
   static float value_axis_units(const AxisEnum axis)     { return axis_value_to_mm(axis, value_float()); }
   static float value_per_axis_units(const AxisEnum axis) { return per_axis_value(axis, value_float()); }
 
@@ -399,7 +484,12 @@ public:
 
   #endif // !TEMPERATURE_UNITS_SUPPORT
 
-  static feedRate_t value_feedrate() { return MMM_TO_MMS(value_linear_units()); }
+  static feedRate_t value_feedrate() {
+    #if ENABLED(INCH_MODE_SUPPORT)
+      if (using_inch_units()) return value_scaled(254, 10 * 60); // in/min to mm/s
+    #endif
+    return value_scaled(1, 60);                                 // mm/min to mm/s
+  }
 
   void unknown_command_warning();
 
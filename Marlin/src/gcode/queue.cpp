@@ -99,15 +99,101 @@ PGM_P GCodeQueue::injected_commands_P; // = nullptr
  */
 char GCodeQueue::injected_commands[64]; // = { 0 }
 
+/**
+ * Finish a command whose text is in place
+ */
+void GCodeQueue::RingBuffer::set_command(CommandLine &command, bool skip_ok
+  OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind)
+) {
+  #if ENABLED(PARSED_COMMAND_QUEUE)
+    // Parse the command once, here. Commands being saved to SD are left as they are.
+    command.has_record = !TERN0(SDSUPPORT, card.flag.saving) && parser.make_record(command.buffer, command.record);
+  #elif HAS_GCODE_RECORDS
+    command.has_record = false;
+  #endif
+  command.skip_ok = skip_ok;
+  TERN_(HAS_MULTI_SERIAL, command.port = serial_ind);
+  TERN_(SERIAL_ACK_WINDOW, command.missing = false);
+}
+
 void GCodeQueue::RingBuffer::commit_command(bool skip_ok
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
-  commands[index_w].skip_ok = skip_ok;
-  TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
+  set_command(commands[index_w], skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
   advance_pos(index_w, 1);
 }
 
+#if ENABLED(SERIAL_ACK_WINDOW)
+
+  /**
+   * Hold a slot for a line that was lost, to be filled when the
+   * host sends it again. Commands after it wait until then.
+   */
+  void GCodeQueue::RingBuffer::commit_missing(const long line OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind)) {
+    CommandLine &command = commands[index_w];
+    command.buffer[0] = '\0';
+    TERN_(HAS_GCODE_RECORDS, command.has_record = false);
+    command.skip_ok = true;
+    TERN_(HAS_MULTI_SERIAL, command.port = serial_ind);
+    command.missing = true;
+    command.line = line;
+    advance_pos(index_w, 1);
+  }
+
+  #if HAS_MULTI_SERIAL
+    #define FROM_PORT(C) (C.port.index == serial_ind.index)
+  #else
+    #define FROM_PORT(C) (UNUSED(serial_ind), true)
+  #endif
+
+  GCodeQueue::CommandLine* GCodeQueue::RingBuffer::missing_slot(const serial_index_t serial_ind, const long line) {
+    for (uint8_t i = 0, ind = index_r; i < length; ++i, ind = (ind + 1) % BUFSIZE) {
+      CommandLine &command = commands[ind];
+      if (command.missing && command.line == line && FROM_PORT(command)) return &command;
+    }
+    return nullptr;
+  }
+
+  // Slots are held in line order, so the first found is the lowest
+  long GCodeQueue::RingBuffer::first_missing(const serial_index_t serial_ind, const long none) {
+    for (uint8_t i = 0, ind = index_r; i < length; ++i, ind = (ind + 1) % BUFSIZE) {
+      const CommandLine &command = commands[ind];
+      if (command.missing && command.line >= 0 && FROM_PORT(command)) return command.line;
+    }
+    return none;
+  }
+
+  // Dropped slots are skipped by advance()
+  void GCodeQueue::RingBuffer::drop_missing(const serial_index_t serial_ind) {
+    for (uint8_t i = 0, ind = index_r; i < length; ++i, ind = (ind + 1) % BUFSIZE) {
+      CommandLine &command = commands[ind];
+      if (command.missing && FROM_PORT(command)) command.line = -1;
+    }
+  }
+
+  #undef FROM_PORT
+
+#endif // SERIAL_ACK_WINDOW
+
+#if ENABLED(BINARY_MOTION_COMMANDS)
+
+  /**
+   * Commit the record filled in at record_slot(). Records are
+   * acknowledged by their packet, so they never send "ok".
+   */
+  void GCodeQueue::RingBuffer::commit_record(TERN_(HAS_MULTI_SERIAL, serial_index_t serial_ind)) {
+    CommandLine &command = commands[index_w];
+    TERN_(PARSED_COMMAND_QUEUE, command.buffer[0] = '\0');  // Otherwise the buffer is the record
+    command.has_record = true;
+    command.skip_ok = true;
+    TERN_(HAS_MULTI_SERIAL, command.port = serial_ind);
+    TERN_(SERIAL_ACK_WINDOW, command.missing = false);
+    advance_pos(index_w, 1);
+  }
+
+#endif
+
 /**
  * Copy a command from RAM into the main command buffer.
  * Return true if the command was successfully added.
@@ -312,6 +398,115 @@ void GCodeQueue::gcode_line_error(FSTR_P const ferr, const serial_index_t serial
   serial_state[serial_ind.index].count = 0;
 }
 
+#if ENABLED(SERIAL_ACK_WINDOW)
+
+  // The parameters of M110 when it's the command of the line, after the optional line number. Else null.
+  static const char* M110_params(const char *cmd) {
+    if (*cmd == 'N') {
+      do cmd++; while (NUMERIC_SIGNED(*cmd));
+      while (*cmd == ' ') cmd++;
+    }
+    return (cmd[0] == 'M' && cmd[1] == '1' && cmd[2] == '1' && cmd[3] == '0' && !NUMERIC(cmd[4])) ? cmd + 4 : nullptr;
+  }
+
+  inline void request_resend(const serial_index_t serial_ind, const long line) {
+    PORT_REDIRECT(SERIAL_PORTMASK(serial_ind)); // Reply to the serial port that sent the command
+    SERIAL_ECHOLNPGM(STR_RESEND, line);
+  }
+
+  /**
+   * Take a numbered line from a port with an ack window. Lines may arrive
+   * ahead of a lost line, so instead of a flush and resend each lost line
+   * gets a held slot and only that line is asked for again. The command
+   * queue waits at a held slot, so commands still run in line order.
+   * Return true to queue the line as the next one.
+   */
+  bool GCodeQueue::window_line(const serial_index_t serial_ind, char * const command, const long gcode_N, const bool M110) {
+    SerialState &serial = serial_state[serial_ind.index];
+
+    // A bad line can't be trusted for its number. Ask for the first line still needed.
+    const char * const apos = strrchr(command, '*');
+    uint8_t checksum = 0, count = apos ? uint8_t(apos - command) : 0;
+    while (count) checksum ^= command[--count];
+    if (!apos || strtol(apos + 1, nullptr, 10) != checksum) {
+      serial.resend_N = ring_buffer.first_missing(serial_ind, serial.last_N + 1);
+      request_resend(serial_ind, serial.resend_N);
+      return false;
+    }
+
+    if (M110) return true;
+
+    // A line sent again fills its held slot. Others are duplicates.
+    if (gcode_N <= serial.last_N) {
+      CommandLine * const slot = ring_buffer.missing_slot(serial_ind, gcode_N);
+      if (slot) {
+        strcpy(slot->buffer, command);
+        ring_buffer.set_command(*slot, true OPTARG(HAS_MULTI_SERIAL, serial_ind));
+        serial.resend_N = -1;
+      }
+      serial.ack = true;
+      return false;
+    }
+
+    // Without room for the line and the lines before it, drop it and ask for the next line once
+    if (gcode_N - serial.last_N > BUFSIZE - ring_buffer.length) {
+      if (serial.resend_N != serial.last_N + 1) {
+        serial.resend_N = serial.last_N + 1;
+        request_resend(serial_ind, serial.resend_N);
+      }
+      return false;
+    }
+
+    // Hold a slot for each line lost ahead of this one. Ask for each one not asked for already.
+    for (long n = serial.last_N + 1; n < gcode_N; ++n) {
+      ring_buffer.commit_missing(n OPTARG(HAS_MULTI_SERIAL, serial_ind));
+      if (n != serial.resend_N) request_resend(serial_ind, n);
+    }
+
+    serial.last_N = gcode_N;
+    return true;
+  }
+
+  /**
+   * M110 takes effect as it arrives, so the lines sent after it can be
+   * numbered from it. 'W<lines>' sets how many lines the host may send
+   * ahead. No 'W' turns the window off, as for a host that just connected.
+   * Lines still awaited are given up.
+   */
+  void GCodeQueue::window_M110(const serial_index_t serial_ind, const char * const params) {
+    SerialState &serial = serial_state[serial_ind.index];
+    const char * const npos = strchr(params, 'N'),
+               * const wpos = strchr(params, 'W');
+    if (npos) serial.last_N = strtol(npos + 1, nullptr, 10);
+    serial.window = wpos ? constrain(strtol(wpos + 1, nullptr, 10), 0L, long(ACK_WINDOW_MAX)) : 0;
+    serial.resend_N = -1;
+    ring_buffer.drop_missing(serial_ind);
+    if (wpos) {
+      PORT_REDIRECT(SERIAL_PORTMASK(serial_ind)); // Reply to the serial port that sent the command
+      SERIAL_ECHOLNPGM("ACK_WINDOW:", serial.window);
+    }
+  }
+
+  /**
+   * Acknowledge all the lines received so far, up to the first one
+   * still awaited, with "ok N<line>". Once for all new lines per port.
+   */
+  void GCodeQueue::send_window_acks() {
+    LOOP_L_N(p, NUM_SERIAL) {
+      SerialState &serial = serial_state[p];
+      if (!serial.ack) continue;
+      serial.ack = false;
+      PORT_REDIRECT(SERIAL_PORTMASK(p));          // Reply to the serial port that sent the commands
+      SERIAL_ECHOPGM(STR_OK " N", ring_buffer.first_missing(p, serial.last_N + 1) - 1);
+      #if ENABLED(ADVANCED_OK)
+        SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - ring_buffer.length);
+      #endif
+      SERIAL_EOL();
+    }
+  }
+
+#endif // SERIAL_ACK_WINDOW
+
 FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", but not "M290", etc
   const char * const m29 = strstr_P(cmd, PSTR("M29"));
   return m29 && !NUMERIC(m29[3]);
@@ -424,8 +619,13 @@ void GCodeQueue::get_serial_commands() {
     hadData = false;
 
     LOOP_L_N(p, NUM_SERIAL) {
-      // Check if the queue is full and exit if it is.
-      if (ring_buffer.full()) return;
+      #if ENABLED(SERIAL_ACK_WINDOW)
+        // With the queue full, only read a port that has a line to send again
+        if (ring_buffer.full() && ring_buffer.first_missing(p, -1) < 0) continue;
+      #else
+        // Check if the queue is full and exit if it is.
+        if (ring_buffer.full()) return;
+      #endif
 
       // No data for this port ? Skip it
       if (!serial_data_available(p)) continue;
@@ -460,7 +660,7 @@ void GCodeQueue::get_serial_commands() {
 
         if (npos) {
 
-          const bool M110 = !!strstr_P(command, PSTR("M110"));
+          const bool M110 = !!TERN(SERIAL_ACK_WINDOW, M110_params(command), strstr_P(command, PSTR("M110")));
 
           if (M110) {
             char* n2pos = strchr(command + 4, 'N');
@@ -469,29 +669,39 @@ void GCodeQueue::get_serial_commands() {
 
           const long gcode_N = strtol(npos + 1, nullptr, 10);
 
-          if (gcode_N != serial.last_N + 1 && !M110) {
-            // In case of error on a serial port, don't prevent other serial port from making progress
-            gcode_line_error(F(STR_ERR_LINE_NO), p);
-            break;
-          }
+          #if ENABLED(SERIAL_ACK_WINDOW)
+            if (serial.window) {
+              if (!window_line(p, command, gcode_N, M110)) continue;
+            }
+            else
+          #endif
+          {
+            if (gcode_N != serial.last_N + 1 && !M110) {
+              // In case of error on a serial port, don't prevent other serial port from making progress
+              gcode_line_error(F(STR_ERR_LINE_NO), p);
+              break;
+            }
 
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum) {
+            char *apos = strrchr(command, '*');
+            if (apos) {
+              uint8_t checksum = 0, count = uint8_t(apos - command);
+              while (count) checksum ^= command[--count];
+              if (strtol(apos + 1, nullptr, 10) != checksum) {
+                // In case of error on a serial port, don't prevent other serial port from making progress
+                gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+                break;
+              }
+            }
+            else {
               // In case of error on a serial port, don't prevent other serial port from making progress
-              gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+              gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
               break;
             }
-          }
-          else {
-            // In case of error on a serial port, don't prevent other serial port from making progress
-            gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
-            break;
+
+            serial.last_N = gcode_N;
           }
 
-          serial.last_N = gcode_N;
+          TERN_(BAUD_RATE_GCODE, serial.numbered_lines++);
         }
         #if ENABLED(SDSUPPORT)
           // Pronterface "M29" and "M29 " has no line number
@@ -533,14 +743,27 @@ void GCodeQueue::get_serial_commands() {
           last_command_time = ms;
         #endif
 
+        #if ENABLED(SERIAL_ACK_WINDOW)
+          // M110 sets the line number and the ack window as it arrives
+          const char * const m110 = M110_params(command);
+          if (m110) window_M110(p, m110);
+          // Numbered lines in a window are acknowledged as they arrive
+          const bool skip_ok = npos && serial.window;
+          if (skip_ok) serial.ack = true;
+        #else
+          constexpr bool skip_ok = false;
+        #endif
+
         // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        ring_buffer.enqueue(serial.line_buffer, skip_ok OPTARG(HAS_MULTI_SERIAL, p));
       }
       else
         process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
 
     } // NUM_SERIAL loop
   } // queue has space, serial has data
+
+  TERN_(SERIAL_ACK_WINDOW, send_window_acks());
 }
 
 #if ENABLED(SDSUPPORT)
@@ -605,7 +828,8 @@ void GCodeQueue::get_serial_commands() {
  *  - The SD card file being actively printed
  */
 void GCodeQueue::get_available_commands() {
-  if (ring_buffer.full()) return;
+  // With an ack window a full queue may still be waiting on a line
+  if (ring_buffer.full() && TERN1(SERIAL_ACK_WINDOW, !ring_buffer.peek_next_command().missing)) return;
 
   get_serial_commands();
 
@@ -616,7 +840,13 @@ void GCodeQueue::get_available_commands() {
  * Run the entire queue in-place. Blocks SD completion/abort until complete.
  */
 void GCodeQueue::exhaust() {
-  while (ring_buffer.occupied()) advance();
+  while (ring_buffer.occupied()) {
+    #if ENABLED(SERIAL_ACK_WINDOW)
+      // Wait for a line to be sent again
+      if (ring_buffer.peek_next_command().missing) { get_available_commands(); idle(); continue; }
+    #endif
+    advance();
+  }
   planner.synchronize();
 }
 
@@ -648,6 +878,15 @@ void GCodeQueue::advance() {
     }
   #endif
 
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    // Wait at a held slot for the line to be sent again, or skip it if given up
+    const CommandLine &command = ring_buffer.peek_next_command();
+    if (command.missing) {
+      if (command.line < 0) ring_buffer.advance_pos(ring_buffer.index_r, -1);
+      return;
+    }
+  #endif
+
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
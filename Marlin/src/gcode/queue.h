@@ -28,6 +28,10 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if HAS_GCODE_RECORDS
+  #include "parser.h"
+#endif
+
 class GCodeQueue {
 public:
   /**
@@ -43,6 +47,14 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+    #if ENABLED(BAUD_RATE_GCODE)
+      uint8_t numbered_lines;       //!< Count of lines taken with a valid line number and checksum
+    #endif
+    #if ENABLED(SERIAL_ACK_WINDOW)
+      uint8_t window;               //!< Lines the host may send ahead (M110 W), 0 for an "ok" per command
+      long resend_N;                //!< The last line asked to be resent
+      bool ack;                     //!< Send a cumulative "ok N<line>"
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -57,11 +69,31 @@ public:
    * command and hands off execution to individual handler functions.
    */
   struct CommandLine {
-    char buffer[MAX_CMD_SIZE];      //!< The command buffer
+    #if ENABLED(PARSED_COMMAND_QUEUE)
+      char buffer[MAX_CMD_SIZE];    //!< The command buffer, empty for a pre-tokenized command
+      GCodeRecord record;           //!< The parsed command
+    #elif HAS_GCODE_RECORDS
+      union {
+        char buffer[MAX_CMD_SIZE];  //!< The command buffer
+        GCodeRecord record;         //!< The pre-tokenized command
+      };
+    #else
+      char buffer[MAX_CMD_SIZE];    //!< The command buffer
+    #endif
+    #if HAS_GCODE_RECORDS
+      bool has_record;              //!< Run from the record instead of the text?
+
+      // A pre-tokenized command, with no text
+      bool tokenized() const { return has_record && TERN1(PARSED_COMMAND_QUEUE, !buffer[0]); }
+    #endif
     bool skip_ok;                   //!< Skip sending ok when command is processed?
     #if HAS_MULTI_SERIAL
       serial_index_t port;          //!< Serial port the command was received on
     #endif
+    #if ENABLED(SERIAL_ACK_WINDOW)
+      bool missing;                 //!< Held for a line to be resent. The queue waits here.
+      long line;                    //!< Number of the missing line, -1 once given up
+    #endif
   };
 
   /**
@@ -79,14 +111,35 @@ public:
 
     void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
 
+    void set_command(CommandLine &command, bool skip_ok
+      OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind)
+    );
+
     void commit_command(bool skip_ok
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind = serial_index_t())
     );
 
+    #if ENABLED(SERIAL_ACK_WINDOW)
+      // Hold the next slot for a line to be resent
+      void commit_missing(const long line OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind));
+      // The slot held for a line, or nullptr
+      CommandLine* missing_slot(const serial_index_t serial_ind, const long line);
+      // The first line held for, or 'none'
+      long first_missing(const serial_index_t serial_ind, const long none);
+      // Stop waiting for the lines held for
+      void drop_missing(const serial_index_t serial_ind);
+    #endif
+
     bool enqueue(const char *cmd, bool skip_ok = true
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind = serial_index_t())
     );
 
+    #if ENABLED(BINARY_MOTION_COMMANDS)
+      // Get the next free slot to fill with a record, then commit it
+      inline GCodeRecord& record_slot() { return commands[index_w].record; }
+      void commit_record(TERN_(HAS_MULTI_SERIAL, serial_index_t serial_ind));
+    #endif
+
     void ok_to_send();
 
     inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
@@ -206,6 +259,17 @@ public:
    */
   static void set_current_line_number(long n) { serial_state[ring_buffer.command_port().index].last_N = n; }
 
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    /**
+     * True if the port of the current command sends lines ahead. Its line
+     * numbers were set as the lines arrived.
+     */
+    static bool ack_window() {
+      const serial_index_t p = ring_buffer.command_port();
+      return p.valid() && serial_state[p.index].window;
+    }
+  #endif
+
   #if ENABLED(BUFFER_MONITORING)
 
     private:
@@ -262,6 +326,12 @@ private:
 
   static void gcode_line_error(FSTR_P const ferr, const serial_index_t serial_ind);
 
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    static bool window_line(const serial_index_t serial_ind, char * const command, const long gcode_N, const bool M110);
+    static void window_M110(const serial_index_t serial_ind, const char * const params);
+    static void send_window_acks();
+  #endif
+
   friend class GcodeSuite;
 };
 
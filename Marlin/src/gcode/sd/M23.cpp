@@ -28,6 +28,10 @@
 #include "../../sd/cardreader.h"
 #include "../../lcd/marlinui.h"
 
+#if ENABLED(BED_ZONE_FOOTPRINT)
+  #include "../../feature/bed_footprint.h"
+#endif
+
 /**
  * M23: Open a file
  *
@@ -38,6 +42,9 @@ void GcodeSuite::M23() {
   for (char *fn = parser.string_arg; *fn; ++fn) if (*fn == ' ') *fn = '\0';
   card.openFileRead(parser.string_arg);
 
+  // Find the bed zones the new print will use
+  TERN_(BED_ZONE_FOOTPRINT, bedfootprint.prescan());
+
   TERN_(LCD_SET_PROGRESS_MANUALLY, ui.set_progress(0));
 }
 
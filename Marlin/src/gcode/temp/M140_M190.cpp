@@ -34,6 +34,10 @@
   #include "../../module/temperature.h"
   #include "../../lcd/marlinui.h"
 
+  #if ENABLED(BED_ZONE_FOOTPRINT)
+    #include "../../feature/bed_footprint.h"
+  #endif
+
   /**
    * M140 - Set Bed Temperature target and return immediately
    * M190 - Set Bed Temperature target and wait
@@ -48,6 +52,10 @@
    * M190 Parameters
    *  R<target> : The target temperature in current units. Wait for heating and cooling.
    *
+   * Multi-zone bed
+   *  B<zone>   : Set only this bed zone. Without B all zones are set, or with
+   *              BED_ZONE_FOOTPRINT only the zones under the print (see M196).
+   *
    * Examples
    *  M140 S60 : Set target to 60° and return right away.
    *  M190 R40 : Set target to 40°. Wait until the bed gets close to 40°.
@@ -80,6 +88,7 @@
   static bool bed_status_reset_all() {
     // Retorna true quando TODAS as beds estiverem próximas do target
     for (uint8_t b = 0; b < BED_COUNT; ++b) {
+      if (TERN0(BED_ZONE_FOOTPRINT, !bedfootprint.zone_active(b))) continue;
       if (!thermalManager.degBedNear(b, thermalManager.degTargetBed(b)))
         return false;
     }
@@ -125,7 +134,14 @@
       if (has_bed_index) {
         thermalManager.setTargetBed(bed_index, temp);
       } else {
-        thermalManager.setAllTargetBed(temp);
+        #if ENABLED(BED_ZONE_FOOTPRINT)
+          // Heat only the zones under the print footprint, once it's known
+          TERN_(SDSUPPORT, bedfootprint.finish_prescan());
+          for (uint8_t b = 0; b < BED_COUNT; ++b)
+            thermalManager.setTargetBed(b, bedfootprint.zone_active(b) ? temp : 0);
+        #else
+          thermalManager.setAllTargetBed(temp);
+        #endif
       }
 
       // 5) Mensagem no LCD
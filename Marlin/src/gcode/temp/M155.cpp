@@ -27,14 +27,33 @@
 #include "../gcode.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(BED_TELEMETRY)
+  #include "../../feature/bed_telemetry.h"
+#endif
+
 /**
  * M155: Set temperature auto-report interval. M155 S<seconds>
+ *
+ * With BED_TELEMETRY:
+ *  B<hz>  : Report all bed zones <hz> times per second (0 = off). Capped by the serial budget.
+ *  F<0|1> : Send bed reports as text lines (0) or binary frames (1). (Requires BED_TELEMETRY_BINARY)
+ *  P<port>: Serial port for the binary frames. Not the port sending M155, to keep them apart from replies.
  */
 void GcodeSuite::M155() {
 
   if (parser.seenval('S'))
     thermalManager.auto_reporter.set_interval(parser.value_byte());
 
+  #if ENABLED(BED_TELEMETRY)
+    const bool seenB = parser.seenval('B'), seenF = parser.seenval('F');
+    if (seenF && !bedtelemetry.set_binary(parser.value_bool(), parser.intval('P', -1))) {
+      SERIAL_ERROR_MSG("Binary bed telemetry needs P<port>, a serial port other than this one.");
+      return;
+    }
+    if (seenB) bedtelemetry.set_rate(parser.byteval('B'));
+    if (seenB || seenF) bedtelemetry.report_settings();
+  #endif
+
 }
 
 #endif // AUTO_REPORT_TEMPERATURES && HAS_TEMP_SENSOR
@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(BED_ZONE_FOOTPRINT)
+
+#include "../gcode.h"
+#include "../../feature/bed_footprint.h"
+
+/**
+ * M196: Set the print footprint used to select the bed zones to heat
+ *
+ *  X<min> Y<min> I<max> J<max> : Footprint rectangle
+ *  A                            : Add the rectangle to the footprint (e.g., one call per M486 object)
+ *  R                            : Clear the footprint and heat all zones
+ *
+ * With no parameters, report the footprint and the active zones.
+ * M140/M190 without B<zone> heat and wait only on the active zones.
+ */
+void GcodeSuite::M196() {
+  #if ENABLED(SDSUPPORT)
+    // The host's footprint replaces one still being scanned
+    if (parser.seen("RXYIJ")) bedfootprint.cancel_prescan();
+  #endif
+
+  if (parser.seen('R')) {
+    bedfootprint.reset();
+  }
+  else if (parser.seenval('X') && parser.seenval('Y') && parser.seenval('I') && parser.seenval('J')) {
+    const xy_pos_t lo = { parser.floatval('X'), parser.floatval('Y') },
+                   hi = { parser.floatval('I'), parser.floatval('J') };
+    if (lo.x > hi.x || lo.y > hi.y) {
+      SERIAL_ERROR_MSG(STR_ERR_M196_BOUNDS);
+      return;
+    }
+    if (parser.seen_test('A'))
+      bedfootprint.include(lo, hi);
+    else
+      bedfootprint.set(lo, hi);
+  }
+  else if (parser.seen('X') || parser.seen('Y') || parser.seen('I') || parser.seen('J')) {
+    SERIAL_ERROR_MSG(STR_ERR_M196_BOUNDS);
+    return;
+  }
+
+  bedfootprint.report();
+}
+
+#endif // BED_ZONE_FOOTPRINT
@@ -39,6 +39,7 @@
  *
  *  S<temperature>  Set the target temperature. (Default: 150C / 70C)
  *  E<extruder>     Extruder number to tune, or -1 for the bed. (Default: E0)
+ *  B<zone>         Bed zone to tune with E-1 on a multi-zone bed. (Default: B0)
  *  C<cycles>       Number of times to repeat the procedure. (Minimum: 3, Default: 5)
  *  U<bool>         Flag to apply the result to the current PID values
  *
@@ -58,7 +59,22 @@ void GcodeSuite::M303() {
     }
   #endif
 
-  const heater_id_t hid = (heater_id_t)parser.intval('E');
+  heater_id_t hid = (heater_id_t)parser.intval('E');
+
+  #if BOTH(HAS_MULTI_BEDS, PIDTEMPBED)
+    // Select a single bed zone to tune. Other zones stay off while tuning.
+    if (hid == H_BED0 && parser.seenval('B')) {
+      const uint8_t bed = parser.value_byte();
+      if (bed >= BED_COUNT) {
+        SERIAL_ECHOPGM(STR_PID_AUTOTUNE);
+        SERIAL_ECHOLNPGM(STR_PID_BAD_HEATER_ID);
+        TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_BAD_EXTRUDER_NUM));
+        return;
+      }
+      hid = heater_id_t(H_BED0 - bed);
+    }
+  #endif
+
   celsius_t default_temp;
   switch (hid) {
     #if ENABLED(PIDTEMP)
@@ -66,6 +82,16 @@ void GcodeSuite::M303() {
     #endif
     #if ENABLED(PIDTEMPBED)
       case H_BED0: default_temp = PREHEAT_1_TEMP_BED; break;
+      #if HAS_MULTI_BEDS
+        case H_BED1:
+        #if BED_COUNT > 2
+          case H_BED2:
+        #endif
+        #if BED_COUNT > 3
+          case H_BED3:
+        #endif
+          default_temp = PREHEAT_1_TEMP_BED; break;
+      #endif
     #endif
     #if ENABLED(PIDTEMPCHAMBER)
       case H_CHAMBER: default_temp = PREHEAT_1_TEMP_CHAMBER; break;
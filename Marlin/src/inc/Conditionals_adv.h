@@ -1021,6 +1021,11 @@
   #define HAS_MEATPACK 1
 #endif
 
+// Commands parsed into records before they run
+#if EITHER(PARSED_COMMAND_QUEUE, BINARY_MOTION_COMMANDS)
+  #define HAS_GCODE_RECORDS 1
+#endif
+
 // AVR are (usually) too limited in resources to store the configuration into the binary
 #if ENABLED(CONFIGURATION_EMBEDDING) && !defined(FORCE_CONFIG_EMBED) && (defined(__AVR__) || DISABLED(SDSUPPORT) || EITHER(SDCARD_READONLY, DISABLE_M503))
   #undef CONFIGURATION_EMBEDDING
@@ -1035,3 +1040,15 @@
 #if EITHER(SENSORLESS_HOMING, SENSORLESS_PROBING) && !defined(SENSORLESS_STALLGUARD_DELAY)
   #define SENSORLESS_STALLGUARD_DELAY 0
 #endif
+
+// Input Shaping
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #define HAS_SHAPING 1
+  #ifndef SHAPING_MIN_FREQ
+    #if BOTH(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+      #define SHAPING_MIN_FREQ _MIN(float(SHAPING_FREQ_X), float(SHAPING_FREQ_Y))
+    #else
+      #define SHAPING_MIN_FREQ TERN(INPUT_SHAPING_X, SHAPING_FREQ_X, SHAPING_FREQ_Y)
+    #endif
+  #endif
+#endif
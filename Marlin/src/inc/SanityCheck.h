@@ -762,13 +762,17 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "SERIAL_XON_XOFF requires RX_BUFFER_SIZE >= 1024 for reliable transfers without drops."
   #elif RX_BUFFER_SIZE && (RX_BUFFER_SIZE < 2 || !IS_POWER_OF_2(RX_BUFFER_SIZE))
     #error "RX_BUFFER_SIZE must be a power of 2 greater than 1."
-  #elif TX_BUFFER_SIZE && (TX_BUFFER_SIZE < 2 || TX_BUFFER_SIZE > 256 || !IS_POWER_OF_2(TX_BUFFER_SIZE))
-    #error "TX_BUFFER_SIZE must be 0 or a power of 2 between 1 and 256."
+  #elif TX_BUFFER_SIZE && (TX_BUFFER_SIZE < 2 || TX_BUFFER_SIZE > TERN(SERIAL_DMA, 8192, 256) || !IS_POWER_OF_2(TX_BUFFER_SIZE))
+    #error "TX_BUFFER_SIZE must be 0 or a power of 2 between 1 and 256 (8192 with SERIAL_DMA)."
   #endif
 #elif ANY(SERIAL_XON_XOFF, SERIAL_STATS_MAX_RX_QUEUED, SERIAL_STATS_DROPPED_RX)
   #error "SERIAL_XON_XOFF and SERIAL_STATS_* features not supported on USB-native AVR devices."
 #endif
 
+#if ENABLED(SERIAL_ACK_WINDOW) && !WITHIN(ACK_WINDOW_MAX, 1, 255)
+  #error "ACK_WINDOW_MAX must be between 1 and 255."
+#endif
+
 /**
  * Multiple Stepper Drivers Per Axis
  */
@@ -1306,6 +1310,112 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #elif NONE(HAS_JUNCTION_DEVIATION, ALLOW_LOW_EJERK) && defined(DEFAULT_EJERK)
     static_assert(DEFAULT_EJERK >= 10, "It is strongly recommended to set DEFAULT_EJERK >= 10 when using LIN_ADVANCE. Enable ALLOW_LOW_EJERK to bypass this alert (e.g., for direct drive).");
   #endif
+  #if ENABLED(SMOOTH_LIN_ADVANCE)
+    #if DISABLED(FT_MOTION)
+      #error "SMOOTH_LIN_ADVANCE requires FT_MOTION."
+    #else
+      static_assert(WITHIN(FTM_FRAME_RATE, 20, 2500), "SMOOTH_LIN_ADVANCE requires an FTM_FRAME_RATE from 20 to 2500.");
+    #endif
+    static_assert(WITHIN(ADVANCE_SMOOTH_TIME, 0, 0.1), "ADVANCE_SMOOTH_TIME must be from 0 to 0.1.");
+  #endif
+#endif
+
+/**
+ * Segment coalescing requirements
+ */
+#if ENABLED(COALESCE_SEGMENTS)
+  #if IS_KINEMATIC
+    #error "COALESCE_SEGMENTS is not compatible with DELTA, SCARA, or POLARGRAPH."
+  #endif
+  static_assert(COALESCE_TOLERANCE > 0, "COALESCE_TOLERANCE must be greater than 0.");
+  static_assert(COALESCE_MAX_LENGTH > 0, "COALESCE_MAX_LENGTH must be greater than 0.");
+  static_assert(WITHIN(COALESCE_MAX_MOVES, 2, 255), "COALESCE_MAX_MOVES must be from 2 to 255.");
+  static_assert(COALESCE_HOLD_MS > 0, "COALESCE_HOLD_MS must be greater than 0.");
+#endif
+
+/**
+ * Path blending requirements
+ */
+#if ENABLED(PATH_BLENDING)
+  #if IS_KINEMATIC
+    #error "PATH_BLENDING is not compatible with DELTA, SCARA, or POLARGRAPH."
+  #elif ENABLED(COALESCE_SEGMENTS)
+    #error "PATH_BLENDING is not compatible with COALESCE_SEGMENTS."
+  #endif
+  static_assert(BLEND_TOLERANCE > 0, "BLEND_TOLERANCE must be greater than 0.");
+  static_assert(BLEND_HOLD_MS > 0, "BLEND_HOLD_MS must be greater than 0.");
+  static_assert(WITHIN(BLEND_MAX_SEGMENTS, 1, (BLOCK_BUFFER_SIZE) - 2), "BLEND_MAX_SEGMENTS must be from 1 to BLOCK_BUFFER_SIZE - 2.");
+#endif
+
+/**
+ * Input Shaping requirements
+ */
+#if HAS_SHAPING
+  #if !IS_FULL_CARTESIAN
+    #error "INPUT_SHAPING_X and INPUT_SHAPING_Y require a Cartesian machine."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "INPUT_SHAPING_X and INPUT_SHAPING_Y are incompatible with DIRECT_STEPPING."
+  #elif ENABLED(INPUT_SHAPING_X) && !HAS_X_STEP
+    #error "INPUT_SHAPING_X requires an X stepper."
+  #elif ENABLED(INPUT_SHAPING_Y) && !HAS_Y_STEP
+    #error "INPUT_SHAPING_Y requires a Y stepper."
+  #endif
+  #if ENABLED(INPUT_SHAPING_X)
+    static_assert(SHAPING_FREQ_X >= SHAPING_MIN_FREQ, "SHAPING_FREQ_X must be at least SHAPING_MIN_FREQ.");
+    static_assert(WITHIN(SHAPING_ZETA_X, 0, 0.99f), "SHAPING_ZETA_X must be from 0 to 0.99.");
+    static_assert(WITHIN(SHAPING_TYPE_X, SHAPER_ZV, SHAPER_EI), "SHAPING_TYPE_X must be SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV or SHAPER_EI.");
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    static_assert(SHAPING_FREQ_Y >= SHAPING_MIN_FREQ, "SHAPING_FREQ_Y must be at least SHAPING_MIN_FREQ.");
+    static_assert(WITHIN(SHAPING_ZETA_Y, 0, 0.99f), "SHAPING_ZETA_Y must be from 0 to 0.99.");
+    static_assert(WITHIN(SHAPING_TYPE_Y, SHAPER_ZV, SHAPER_EI), "SHAPING_TYPE_Y must be SHAPER_ZV, SHAPER_ZVD, SHAPER_MZV or SHAPER_EI.");
+  #endif
+#endif
+
+/**
+ * Fixed-Time Motion requirements
+ */
+#if ENABLED(FT_MOTION)
+  #ifdef __AVR__
+    #error "FT_MOTION requires a 32-bit board."
+  #elif IS_CORE || EITHER(MARKFORGED_XY, MARKFORGED_YX)
+    #error "FT_MOTION is not compatible with Core or Markforged kinematics."
+  #elif ENABLED(LIN_ADVANCE) && DISABLED(SMOOTH_LIN_ADVANCE)
+    #error "FT_MOTION requires SMOOTH_LIN_ADVANCE with LIN_ADVANCE."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "FT_MOTION is not compatible with DIRECT_STEPPING."
+  #elif ENABLED(MIXING_EXTRUDER)
+    #error "FT_MOTION is not compatible with MIXING_EXTRUDER."
+  #elif HAS_CUTTER
+    #error "FT_MOTION is not compatible with a spindle or laser."
+  #endif
+  static_assert(WITHIN(FTM_STEPS_PER_FRAME, 2, 255), "FTM_STEPS_PER_FRAME must be from 2 to 255.");
+  static_assert(WITHIN(FTM_BUFFER_FRAMES, 4, 255), "FTM_BUFFER_FRAMES must be from 4 to 255.");
+  static_assert(FTM_FRAME_RATE > 0, "FTM_FRAME_RATE must be greater than 0.");
+  #if ENABLED(FTM_CURVE_BLOCKS)
+    #if IS_KINEMATIC
+      #error "FTM_CURVE_BLOCKS is not compatible with DELTA, SCARA, or POLARGRAPH."
+    #elif ENABLED(BACKLASH_COMPENSATION)
+      #error "FTM_CURVE_BLOCKS is not compatible with BACKLASH_COMPENSATION."
+    #endif
+  #endif
+  #if ENABLED(FTM_STEP_DMA)
+    #ifndef HAL_STEP_DMA
+      #error "FTM_STEP_DMA is not supported on this platform."
+    #elif HAS_MULTI_EXTRUDER
+      #error "FTM_STEP_DMA is not compatible with multiple extruders."
+    #elif ENABLED(DUAL_X_CARRIAGE)
+      #error "FTM_STEP_DMA is not compatible with DUAL_X_CARRIAGE."
+    #elif HAS_EXTRA_ENDSTOPS || ENABLED(Z_STEPPER_AUTO_ALIGN)
+      #error "FTM_STEP_DMA is not compatible with multiple endstops or Z_STEPPER_AUTO_ALIGN."
+    #elif ENABLED(BABYSTEPPING)
+      #error "FTM_STEP_DMA is not compatible with BABYSTEPPING."
+    #endif
+    // Each pattern word lasts for the step pulse and the delays around a DIR change
+    static_assert(1e9 / ((2 * (FTM_STEPS_PER_FRAME) + 1) * float(FTM_FRAME_RATE))
+                  >= _MAX(1000.0f * (MINIMUM_STEPPER_PULSE), MINIMUM_STEPPER_POST_DIR_DELAY, MINIMUM_STEPPER_PRE_DIR_DELAY),
+                  "FTM_STEP_DMA pattern words are too short for the stepper driver timing. Lower FTM_FRAME_RATE or FTM_STEPS_PER_FRAME.");
+  #endif
 #endif
 
 /**
@@ -1465,6 +1575,60 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "To use BED_LIMIT_SWITCHING you must disable PIDTEMPBED."
 #endif
 
+#if ENABLED(BED_ZONE_COUPLING) && !(HAS_MULTI_BEDS && ENABLED(PIDTEMPBED))
+  #error "BED_ZONE_COUPLING requires multiple bed zones and PIDTEMPBED."
+#endif
+
+#if (ADS1115_BED_READING || PCF8574_BED_CONTROL) && DISABLED(I2C_ASYNC_QUEUE)
+  #error "ADS1115_BED_READING and PCF8574_BED_CONTROL require I2C_ASYNC_QUEUE."
+#elif ENABLED(I2C_ASYNC_QUEUE) && !WITHIN(I2C_ASYNC_QUEUE_SIZE, 2, 32)
+  #error "I2C_ASYNC_QUEUE_SIZE must be between 2 and 32."
+#endif
+
+#if ENABLED(BED_ZONE_FOOTPRINT)
+  #if !HAS_MULTI_BEDS
+    #error "BED_ZONE_FOOTPRINT requires multiple bed zones."
+  #elif (BED_ZONE_GRID_X) * (BED_ZONE_GRID_Y) != BED_COUNT
+    #error "BED_ZONE_GRID_X * BED_ZONE_GRID_Y must equal the number of bed zones."
+  #elif BED_ZONE_MARGIN < 0
+    #error "BED_ZONE_MARGIN must be 0 or greater."
+  #endif
+#endif
+
+#if ENABLED(BED_TELEMETRY)
+  #if !HAS_MULTI_BEDS
+    #error "BED_TELEMETRY requires multiple bed zones."
+  #elif DISABLED(AUTO_REPORT_TEMPERATURES)
+    #error "BED_TELEMETRY requires AUTO_REPORT_TEMPERATURES."
+  #elif !WITHIN(BED_TELEMETRY_MAX_HZ, 1, 100)
+    #error "BED_TELEMETRY_MAX_HZ must be between 1 and 100."
+  #elif !WITHIN(BED_TELEMETRY_BUDGET, 1, 100)
+    #error "BED_TELEMETRY_BUDGET must be between 1 and 100."
+  #elif ENABLED(BED_TELEMETRY_BINARY) && !HAS_MULTI_SERIAL
+    #error "BED_TELEMETRY_BINARY requires SERIAL_PORT_2, to send the frames apart from command replies."
+  #endif
+#endif
+
+#if ADS1115_BED_READING
+  #if TEMP_SENSOR_BED0 != 133
+    #error "ADS1115_BED_READING uses the thermistor 133 table in thermistor_ads1115.h. Regenerate it for other sensors."
+  #elif !WITHIN(ADS1115_DATA_RATE, 8, 860)
+    #error "ADS1115_DATA_RATE must be between 8 and 860."
+  #elif !WITHIN(ADS1115_SAMPLES, 1, 7)
+    #error "ADS1115_SAMPLES must be between 1 and 7."
+  #elif !WITHIN(ADS1115_IIR_SHIFT, 0, 6)
+    #error "ADS1115_IIR_SHIFT must be between 0 and 6."
+  #endif
+#endif
+
+#if PCF8574_BED_CONTROL
+  #ifndef PCF8574_PWM_WINDOW_MS
+    #error "PCF8574_BED_CONTROL requires PCF8574_PWM_WINDOW_MS."
+  #elif !WITHIN(PCF8574_PWM_WINDOW_MS, 1000, 30000)
+    #error "PCF8574_PWM_WINDOW_MS must be between 1000 and 30000."
+  #endif
+#endif
+
 /**
  * Synchronous M106/M107 checks
  */
@@ -1563,6 +1727,16 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+/**
+ * S-Curve jerk limit
+ */
+#ifdef S_CURVE_MAX_JERK
+  #if DISABLED(S_CURVE_ACCELERATION)
+    #error "S_CURVE_MAX_JERK requires S_CURVE_ACCELERATION."
+  #endif
+  static_assert(S_CURVE_MAX_JERK > 0, "S_CURVE_MAX_JERK must be greater than 0.");
+#endif
+
 /**
  * Junction deviation is incompatible with kinematic systems.
  */
@@ -1570,6 +1744,16 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "CLASSIC_JERK is required for DELTA and SCARA."
 #endif
 
+/**
+ * Adaptive segments are for kinematic systems
+ */
+#if ENABLED(KINEMATIC_ADAPTIVE_SEGMENTS)
+  #if !IS_KINEMATIC
+    #error "KINEMATIC_ADAPTIVE_SEGMENTS requires DELTA, SCARA, or POLARGRAPH."
+  #endif
+  static_assert(KINEMATIC_SEGMENT_TOLERANCE > 0, "KINEMATIC_SEGMENT_TOLERANCE must be greater than 0.");
+#endif
+
 /**
  * Some things should not be used on Belt Printers
  */
@@ -3498,8 +3682,19 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
 
 #if !BLOCK_BUFFER_SIZE || !IS_POWER_OF_2(BLOCK_BUFFER_SIZE)
   #error "BLOCK_BUFFER_SIZE must be a power of 2."
-#elif BLOCK_BUFFER_SIZE > 64
-  #error "A very large BLOCK_BUFFER_SIZE is not needed and takes longer to drain the buffer on pause / cancel."
+#elif BLOCK_BUFFER_SIZE > 128
+  #error "BLOCK_BUFFER_SIZE must be 128 or less."
+#elif BLOCK_BUFFER_SIZE > 64 && DISABLED(PLANNER_TIME_BUFFER)
+  #error "A very large BLOCK_BUFFER_SIZE is not needed and takes longer to drain the buffer on pause / cancel. Enable PLANNER_TIME_BUFFER to use it."
+#endif
+
+#if ENABLED(PLANNER_TIME_BUFFER)
+  #ifdef __AVR__
+    #error "PLANNER_TIME_BUFFER requires a 32-bit board."
+  #elif PLANNER_BUFFER_MIN_MOVES < 2 || PLANNER_BUFFER_MIN_MOVES >= BLOCK_BUFFER_SIZE
+    #error "PLANNER_BUFFER_MIN_MOVES must be from 2 to BLOCK_BUFFER_SIZE - 1."
+  #endif
+  static_assert(PLANNER_BUFFER_TIME > 0, "PLANNER_BUFFER_TIME must be greater than 0.");
 #endif
 
 #if ENABLED(LED_CONTROL_MENU) && NONE(HAS_MARLINUI_MENU, DWIN_LCD_PROUI)
@@ -3841,6 +4036,24 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
 
+/**
+ * Binary Motion Commands
+ */
+#if ENABLED(BINARY_MOTION_COMMANDS)
+  #if DISABLED(BINARY_FILE_TRANSFER)
+    #error "BINARY_MOTION_COMMANDS requires BINARY_FILE_TRANSFER."
+  #elif DISABLED(FASTER_GCODE_PARSER)
+    #error "BINARY_MOTION_COMMANDS requires FASTER_GCODE_PARSER."
+  #endif
+#endif
+
+/**
+ * Parsed Command Queue
+ */
+#if ENABLED(PARSED_COMMAND_QUEUE) && DISABLED(FASTER_GCODE_PARSER)
+  #error "PARSED_COMMAND_QUEUE requires FASTER_GCODE_PARSER."
+#endif
+
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
  */
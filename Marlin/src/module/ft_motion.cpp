@@ -0,0 +1,528 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(FT_MOTION)
+
+#include "ft_motion.h"
+#include "stepper.h"
+
+#if ENABLED(FTM_CURVE_BLOCKS)
+  #include "motion.h"
+#endif
+
+#if ENABLED(POWER_LOSS_RECOVERY)
+  #include "../feature/powerloss.h"
+#endif
+
+FTMotion ftMotion;
+
+bool FTMotion::active; // = false
+
+ft_frame_t FTMotion::frames[FTM_BUFFER_FRAMES];
+volatile uint8_t FTMotion::frame_head, // = 0
+                 FTMotion::frame_tail; // = 0
+volatile bool FTMotion::aborted; // = false
+#if ENABLED(FTM_STEP_DMA)
+  volatile uint8_t FTMotion::dma_frames; // = 0
+#endif
+
+block_t* FTMotion::block; // = nullptr
+float FTMotion::block_time,
+      FTMotion::ratio[LOGICAL_AXES];
+FTMotion::profile_t FTMotion::profile;
+#if ENABLED(FTM_CURVE_BLOCKS)
+  ft_curve_t FTMotion::curves[BLOCK_BUFFER_SIZE];
+  const ft_curve_t* FTMotion::curve; // = nullptr
+#endif
+
+abce_long_t FTMotion::base, FTMotion::target, FTMotion::emitted;
+axis_bits_t FTMotion::dir_bits, FTMotion::block_bits;
+uint8_t FTMotion::blocks_done; // = 0
+#if HAS_MULTI_EXTRUDER
+  uint8_t FTMotion::extruder; // = 0
+#endif
+
+#if ENABLED(SMOOTH_LIN_ADVANCE)
+  float FTMotion::advance_time = ADVANCE_SMOOTH_TIME;
+  uint8_t FTMotion::advance_half = _MAX(1, LROUND((ADVANCE_SMOOTH_TIME) * (FTM_FRAME_RATE) / 2)),
+          FTMotion::delay_index, // = 0
+          FTMotion::lead_index,  // = 0
+          FTMotion::unsettled;   // = 0
+  int32_t FTMotion::lead_base, FTMotion::lead;
+  FTMotion::delayed_t FTMotion::delayed[FTM_ADVANCE_HALF_MAX + 1];
+  int32_t FTMotion::lead_hist[2 * (FTM_ADVANCE_HALF_MAX) + 1];
+#endif
+
+#if ENABLED(FTM_CURVE_BLOCKS)
+
+  static xy_float_t unit(const xy_float_t &v) {
+    const float m = v.magnitude();
+    return m > 0 ? v / m : v;
+  }
+
+  /**
+   * Arc from the start point around the center c, by angle a. The radius goes
+   * to end_radius on the way, as the end point given to G2/G3 may be off the circle.
+   */
+  void ft_curve_t::set_arc(const AxisEnum p, const AxisEnum q, const xy_float_t &c, const float a, const float end_radius) {
+    axis_p = p; axis_q = q;
+    bezier = false;
+    center = c;
+    angle = a;
+    const float radius = c.magnitude();
+    grow = end_radius / radius - 1;
+    min_radius = _MIN(radius, end_radius);
+    planar_mm = 0.5f * (radius + end_radius) * ABS(a);
+
+    // Tangents turn 90° from the radius, in the direction of rotation
+    const xy_float_t r0 = -c, r1 = { r0.x * cos(a) - r0.y * sin(a), r0.x * sin(a) + r0.y * cos(a) };
+    const float sign = a < 0 ? -1 : 1;
+    start_dir = unit(xy_float_t({ -r0.y, r0.x }) * sign);
+    end_dir = unit(xy_float_t({ -r1.y, r1.x }) * sign);
+  }
+
+  // Bézier derivatives, with the curve starting at 0
+  static xy_float_t bezier_d1(const xy_float_t (&c)[3], const float t) {
+    const float u = 1 - t;
+    return c[0] * (3 * sq(u)) + (c[1] - c[0]) * (6 * u * t) + (c[2] - c[1]) * (3 * sq(t));
+  }
+  static xy_float_t bezier_d2(const xy_float_t (&c)[3], const float t) {
+    return (c[1] - c[0] * 2) * (6 * (1 - t)) + (c[2] - c[1] * 2 + c[0]) * (6 * t);
+  }
+
+  // Radius of curvature of a Bézier at parameter t
+  float ft_curve_t::bend_radius(const float t) const {
+    const xy_float_t d1 = bezier_d1(ctrl, t), d2 = bezier_d2(ctrl, t);
+    const float cross = ABS(d1.x * d2.y - d1.y * d2.x), speed = d1.magnitude();
+    return cross > 0 ? speed * speed * speed / cross : 1e9f;
+  }
+
+  // Tightest radius of curvature in a piece of a Bézier, from its ends and the Gauss points
+  float ft_curve_t::piece_radius(const uint8_t i) const {
+    constexpr float h = 1.0f / (FTM_CURVE_SAMPLES), g = h * 0.2113249f; // (1 - 1/sqrt(3)) / 2
+    return _MIN(bend_radius(i * h), bend_radius(i * h + g), bend_radius((i + 1) * h - g), bend_radius((i + 1) * h));
+  }
+
+  /**
+   * Bézier from the start point through control points c1 and c2 to the end.
+   * The length of each piece comes from two-point Gauss quadrature of the speed.
+   */
+  void ft_curve_t::set_bezier(const xy_float_t &c1, const xy_float_t &c2, const xy_float_t &end) {
+    axis_p = X_AXIS; axis_q = Y_AXIS;
+    bezier = true;
+    ctrl[0] = c1; ctrl[1] = c2; ctrl[2] = end;
+
+    constexpr float h = 1.0f / (FTM_CURVE_SAMPLES), g = h * 0.2113249f;
+    float len = 0;
+    min_radius = 1e9f;
+    LOOP_L_N(i, FTM_CURVE_SAMPLES) {
+      len += 0.5f * h * (bezier_d1(ctrl, i * h + g).magnitude() + bezier_d1(ctrl, (i + 1) * h - g).magnitude());
+      length[i] = len;
+      NOMORE(min_radius, piece_radius(i));
+    }
+    planar_mm = len;
+
+    // A control point on an end gives no direction there, so look further along
+    start_dir = unit(NEAR_ZERO(c1.magnitude()) ? (NEAR_ZERO(c2.magnitude()) ? end : c2) : c1);
+    end_dir = unit(NEAR_ZERO((end - c2).magnitude()) ? (NEAR_ZERO((end - c1).magnitude()) ? end : end - c1) : end - c2);
+  }
+
+  /**
+   * Piece numbers where a Bézier should be cut, so that the tightest bend of each
+   * part doesn't slow down much gentler ones. Bends wider than max_radius don't
+   * limit the speed, so they all count the same. Return the number of parts.
+   */
+  uint8_t ft_curve_t::bezier_cuts(const float max_radius, uint8_t (&cut)[FTM_CURVE_SAMPLES + 1]) const {
+    uint8_t parts = 0;
+    cut[0] = 0;
+    float part_radius = _MIN(piece_radius(0), max_radius);
+    LOOP_S_L_N(i, 1, FTM_CURVE_SAMPLES) {
+      const float r = _MIN(piece_radius(i), max_radius);
+      if (r < part_radius * 0.5f || r > part_radius * 2) {
+        cut[++parts] = i;
+        part_radius = r;
+      }
+      else
+        NOMORE(part_radius, r);
+    }
+    cut[++parts] = FTM_CURVE_SAMPLES;
+    return parts;
+  }
+
+  // Bézier point at parameter t
+  xy_float_t ft_curve_t::at(const float t) const {
+    const float u = 1 - t;
+    return ctrl[0] * (3 * sq(u) * t) + ctrl[1] * (3 * u * sq(t)) + ctrl[2] * (sq(t) * t);
+  }
+
+  // The part of a Bézier between two of its pieces, as a curve starting at its own start point
+  void ft_curve_t::set_bezier_part(const ft_curve_t &whole, const uint8_t i0, const uint8_t i1) {
+    // Control polygon of the part, by de Casteljau's algorithm, for the hodograph
+    const float t0 = float(i0) / (FTM_CURVE_SAMPLES), t1 = float(i1) / (FTM_CURVE_SAMPLES), k = (t1 - t0) / 3;
+    const xy_float_t p0 = whole.at(t0), p3 = whole.at(t1),
+                     p1 = p0 + bezier_d1(whole.ctrl, t0) * k,
+                     p2 = p3 - bezier_d1(whole.ctrl, t1) * k;
+    set_bezier(p1 - p0, p2 - p0, p3 - p0);
+  }
+
+  xy_float_t ft_curve_t::point(const float s) const {
+    if (!bezier) {
+      const float a = angle * s, r = 1 + grow * s, c = cos(a) * r, sn = sin(a) * r;
+      return center + xy_float_t({ -center.x * c + center.y * sn, -center.x * sn - center.y * c });
+    }
+
+    // Find the piece with the length done, and the parameter in it
+    const float done = s * planar_mm;
+    uint8_t i = 0;
+    while (i < (FTM_CURVE_SAMPLES) - 1 && length[i] < done) i++;
+    const float before = i ? length[i - 1] : 0, piece = length[i] - before;
+    return at((i + (piece > 0 ? constrain((done - before) / piece, 0.0f, 1.0f) : 1.0f)) / (FTM_CURVE_SAMPLES));
+  }
+
+  bool ft_curve_t::within_limits(const xyz_pos_t &start) const {
+    // An arc stays in the square around its circle, a Bézier in the box of its control points
+    xy_float_t lo, hi;
+    if (bezier) {
+      lo.set(_MIN(0.0f, ctrl[0].x, ctrl[1].x, ctrl[2].x), _MIN(0.0f, ctrl[0].y, ctrl[1].y, ctrl[2].y));
+      hi.set(_MAX(0.0f, ctrl[0].x, ctrl[1].x, ctrl[2].x), _MAX(0.0f, ctrl[0].y, ctrl[1].y, ctrl[2].y));
+    }
+    else {
+      const float r = center.magnitude() * (1 + _MAX(grow, 0.0f));
+      lo.set(center.x - r, center.y - r);
+      hi.set(center.x + r, center.y + r);
+    }
+    xyz_pos_t corner[2] = { start, start };
+    corner[0][axis_p] += lo.x; corner[0][axis_q] += lo.y;
+    corner[1][axis_p] += hi.x; corner[1][axis_q] += hi.y;
+    for (xyz_pos_t &c : corner) {
+      const xyz_pos_t limited = c;
+      apply_motion_limits(c);
+      if (c != limited) return false;
+    }
+    return true;
+  }
+
+#endif // FTM_CURVE_BLOCKS
+
+void FTMotion::set_active(const bool on) {
+  if (on == active) return;
+  planner.synchronize();
+
+  const bool was_enabled = stepper.suspend();
+  active = on;
+  reset();
+
+  // Both modes go on from the DIR outputs set here
+  #if ENABLED(INPUT_SHAPING_X)
+    stepper.update_shaping(X_AXIS);
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    stepper.update_shaping(Y_AXIS);
+  #endif
+  stepper.set_directions();
+  dir_bits = stepper.last_direction_bits;
+
+  if (was_enabled) stepper.wake_up();
+}
+
+void FTMotion::reset() {
+  frame_tail = frame_head;
+  block = nullptr;
+  block_time = 0;
+  blocks_done = 0;
+  block_bits = 0;
+  base.reset();
+  target.reset();
+  emitted.reset();
+  TERN_(FTM_CURVE_BLOCKS, curve = nullptr);
+  TERN_(SMOOTH_LIN_ADVANCE, clear_advance());
+}
+
+#if ENABLED(SMOOTH_LIN_ADVANCE)
+
+  void FTMotion::set_advance_time(const float t) {
+    planner.synchronize();
+    advance_time = constrain(t, 0.0f, FTM_ADVANCE_MAX_TIME);
+    advance_half = constrain(LROUND(advance_time * (FTM_FRAME_RATE) / 2), 1, FTM_ADVANCE_HALF_MAX);
+    clear_advance();
+  }
+
+  // Fill the delay lines with the position the motion stands at
+  void FTMotion::clear_advance() {
+    lead_base = lead = 0;
+    for (uint8_t i = 0; i <= advance_half; i++) delayed[i] = { target, 0, 0 };
+    for (uint8_t i = 0; i <= 2 * advance_half; i++) lead_hist[i] = 0;
+    delay_index = lead_index = unsettled = 0;
+  }
+
+  /**
+   * Swap the motion of this frame for the one from half the averaging time ago,
+   * and add the advance to E. It comes from the E steps of the moves with advance
+   * over the averaging time, centered on the frame that comes out.
+   */
+  void FTMotion::advance_frame(abce_long_t &pos, axis_bits_t &move_bits, uint8_t &done) {
+    const uint8_t half = advance_half, window = 2 * half;
+
+    // Once the motion stands still for a whole window all the frames are out
+    const delayed_t &newest = delayed[delay_index];
+    bool moved = lead != lead_hist[lead_index];
+    LOOP_LOGICAL_AXES(a) if (pos[a] != newest.pos[a]) moved = true;
+    if (moved) unsettled = window; else if (unsettled) unsettled--;
+
+    delay_index = delay_index < half ? delay_index + 1 : 0;
+    delayed_t &d = delayed[delay_index];
+    const delayed_t out = d;
+    d = { pos, move_bits, done };
+
+    lead_index = lead_index < window ? lead_index + 1 : 0;
+    const int32_t lead_steps = lead - lead_hist[lead_index];
+    lead_hist[lead_index] = lead;
+
+    const float K = planner.extruder_advance_K[TERN0(HAS_MULTI_EXTRUDER, extruder)];
+    pos = out.pos;
+    pos.e += LROUND(K * lead_steps / (window * (FTM_FRAME_TIME)));
+    move_bits = out.move_bits;
+    done = out.blocks_done;
+  }
+
+#endif // SMOOTH_LIN_ADVANCE
+
+void FTMotion::loop() {
+  if (!active) return;
+
+  // The stepper dropped the frames, so drop the blocks they came from
+  if (aborted) {
+    aborted = false;
+    while (planner.block_buffer_tail != planner.block_buffer_nonbusy) planner.release_current_block();
+    reset();
+  }
+
+  // Keep one frame free to tell a full buffer from an empty one
+  while (next_frame_index(frame_head) != frame_tail) {
+    if (!block && caught_up() && !next_block()) break;
+    if (!make_frame()) break;
+  }
+}
+
+/**
+ * Get the next block to turn into frames. Sync blocks take effect
+ * here, once the stepper has played all the frames before them.
+ */
+bool FTMotion::next_block() {
+  while (planner.block_buffer_nonbusy != planner.block_buffer_head) {
+    block_t * const b = &planner.block_buffer[planner.block_buffer_nonbusy];
+    if (!b->is_sync()) return next_move();
+
+    // The moves before the sync block must be done
+    if (frame_head != frame_tail || TERN0(FTM_STEP_DMA, dma_frames) || planner.block_buffer_tail != planner.block_buffer_nonbusy) return false;
+    if (!planner.get_next_block()) return false;
+
+    TERN_(LASER_SYNCHRONOUS_M106_M107, if (b->is_fan_sync()) planner.sync_fan_speeds(b->fan_speed));
+
+    if (!(b->is_fan_sync() || b->is_pwr_sync())) {
+      const bool was_enabled = stepper.suspend();
+      stepper._set_position(b->position);
+      if (was_enabled) stepper.wake_up();
+    }
+
+    planner.release_current_block();
+
+    // Nothing is in flight, so start counting from zero again
+    base.reset();
+    target.reset();
+    emitted.reset();
+    TERN_(SMOOTH_LIN_ADVANCE, clear_advance());
+  }
+
+  return false;
+}
+
+/**
+ * Start the next move block, if the planner has one ready. Taken blocks hold
+ * their place in the planner buffer until played, so unless the frames run low
+ * leave half the buffer to the planner for its lookahead.
+ */
+bool FTMotion::next_move() {
+  const uint8_t nonbusy = planner.block_buffer_nonbusy;
+  if (nonbusy == planner.block_buffer_head) return false;
+  if (planner.block_buffer[nonbusy].is_sync()) return false;
+  if (frames_queued() > (FTM_BUFFER_FRAMES) / 4 && planner.nonbusy_movesplanned() <= (BLOCK_BUFFER_SIZE) / 2) return false;
+  block_t * const b = planner.get_next_block();
+  if (!b) return false;
+  start_block(b);
+  return true;
+}
+
+/**
+ * Set up the trapezoid of a block in step events and seconds. The rates come
+ * from the planner, and the peak rate is lowered for blocks too short to cruise.
+ */
+void FTMotion::start_block(block_t * const b) {
+  block = b;
+  block_time = 0;
+
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    recovery.info.sdpos = b->sdpos;
+    recovery.info.current_position = b->start_position;
+  #endif
+
+  profile_t &p = profile;
+  const float events = b->step_event_count;
+  float initial_rate = b->initial_rate, final_rate = b->final_rate, cruise_rate = b->nominal_rate;
+  p.accel = b->acceleration_steps_per_s2;
+  if (p.accel > 0) NOMORE(cruise_rate, SQRT(p.accel * events + 0.5f * (sq(initial_rate) + sq(final_rate))));
+  NOMORE(initial_rate, cruise_rate);
+  NOMORE(final_rate, cruise_rate);
+
+  const float decel_time = p.accel > 0 ? (cruise_rate - final_rate) / p.accel : 0;
+  p.initial_rate = initial_rate;
+  p.cruise_rate = cruise_rate;
+  p.accel_time = p.accel > 0 ? (cruise_rate - initial_rate) / p.accel : 0;
+  p.accel_events = 0.5f * (initial_rate + cruise_rate) * p.accel_time;
+  p.cruise_events = _MAX(events - p.accel_events - 0.5f * (cruise_rate + final_rate) * decel_time, 0.0f);
+  p.cruise_time = p.cruise_events / cruise_rate;
+  p.total_time = p.accel_time + p.cruise_time + decel_time;
+
+  const float inv_events = 1.0f / events;
+  block_bits = 0;
+  LOOP_LOGICAL_AXES(a) {
+    const float steps = b->steps[a];
+    ratio[a] = (TEST(b->direction_bits, a) ? -steps : steps) * inv_events;
+    if (b->steps[a]) SBI(block_bits, a);
+  }
+  dir_bits = (dir_bits & ~block_bits) | (b->direction_bits & block_bits);
+
+  TERN_(HAS_MULTI_EXTRUDER, extruder = b->extruder);
+
+  #if ENABLED(FTM_CURVE_BLOCKS)
+    curve = b->flag.curve ? &curves[planner.block_index(b)] : nullptr;
+  #endif
+}
+
+// Step events done after t seconds in the block
+float FTMotion::block_events(float t) {
+  const profile_t &p = profile;
+  if (t < p.accel_time) return (p.initial_rate + 0.5f * p.accel * t) * t;
+  t -= p.accel_time;
+  if (t < p.cruise_time) return p.accel_events + p.cruise_rate * t;
+  t -= p.cruise_time;
+  return p.accel_events + p.cruise_events + (p.cruise_rate - 0.5f * p.accel * t) * t;
+}
+
+#if ENABLED(FTM_CURVE_BLOCKS)
+
+  // Place the plane axes of a curve block on the curve
+  void FTMotion::trace_curve(const float events) {
+    const xy_float_t pt = curve->point(events / block->step_event_count);
+    const AxisEnum p = curve->axis_p, q = curve->axis_q;
+    target[p] = base[p] + LROUND(pt.x * planner.settings.axis_steps_per_mm[p]);
+    target[q] = base[q] + LROUND(pt.y * planner.settings.axis_steps_per_mm[q]);
+  }
+
+#endif
+
+// The block is done. Land exactly on its end position.
+void FTMotion::end_block() {
+  LOOP_LOGICAL_AXES(a) {
+    #if ENABLED(FTM_CURVE_BLOCKS)
+      // The steps of a curve's plane axes are its length, so it ends at its chord
+      if (curve && a == curve->axis_p) { base[a] += curve->chord.x; continue; }
+      if (curve && a == curve->axis_q) { base[a] += curve->chord.y; continue; }
+    #endif
+    const int32_t steps = block->steps[a];
+    base[a] += TEST(block->direction_bits, a) ? -steps : steps;
+  }
+  #if ENABLED(SMOOTH_LIN_ADVANCE)
+    if (block->use_advance_lead) {
+      const int32_t steps = block->steps.e;
+      lead_base += TEST(block->direction_bits, E_AXIS) ? -steps : steps;
+    }
+    lead = lead_base;
+  #endif
+  TERN_(FTM_CURVE_BLOCKS, curve = nullptr);
+  target = base;
+  block = nullptr;
+  block_bits = 0;
+  blocks_done++;
+}
+
+/**
+ * Move on by one frame, through as many blocks as it takes, and store the
+ * steps of each axis. Steps over the per-frame limit go in the next frames.
+ * Return false if the stepper dropped the frames meanwhile.
+ */
+bool FTMotion::make_frame() {
+  axis_bits_t move_bits = block_bits;
+
+  float dt = FTM_FRAME_TIME;
+  while (block || next_move()) {
+    move_bits |= block_bits;
+    const float left = profile.total_time - block_time;
+    if (dt < left) {
+      block_time += dt;
+      const float events = block_events(block_time);
+      LOOP_LOGICAL_AXES(a) target[a] = base[a] + LROUND(ratio[a] * events);
+      TERN_(FTM_CURVE_BLOCKS, if (curve) trace_curve(events));
+      TERN_(SMOOTH_LIN_ADVANCE, if (block->use_advance_lead) lead = lead_base + LROUND(ratio[E_AXIS] * events));
+      break;
+    }
+    dt -= left;
+    end_block();
+  }
+
+  // The position the frame goes to
+  #if ENABLED(SMOOTH_LIN_ADVANCE)
+    abce_long_t pos = target;
+    uint8_t done = blocks_done;
+    advance_frame(pos, move_bits, done);
+  #else
+    const abce_long_t &pos = target;
+    const uint8_t done = blocks_done;
+  #endif
+
+  ft_frame_t &f = frames[frame_head];
+  LOOP_LOGICAL_AXES(a) {
+    const int32_t d = constrain(pos[a] - emitted[a], -(FTM_STEPS_PER_FRAME), FTM_STEPS_PER_FRAME);
+    emitted[a] += d;
+    f.steps[a] = ABS(d);
+    if (d) {
+      SBI(move_bits, a);
+      SET_BIT_TO(dir_bits, a, d < 0);
+    }
+  }
+  f.dir_bits = dir_bits;
+  f.move_bits = move_bits;
+  f.blocks_done = done;
+  TERN_(HAS_MULTI_EXTRUDER, f.extruder = extruder);
+  blocks_done = 0;
+
+  // Hand the frame to the stepper, unless it has just dropped the others
+  CRITICAL_SECTION_START();
+    const bool ok = !aborted;
+    if (ok) frame_head = next_frame_index(frame_head);
+  CRITICAL_SECTION_END();
+  return ok;
+}
+
+#endif // FT_MOTION
@@ -0,0 +1,225 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * ft_motion.h - Fixed-Time Motion
+ *
+ * The main loop follows the speed profile of each planner block and turns it
+ * into the number of steps each axis takes in every frame of 1/FTM_FRAME_RATE
+ * seconds. The stepper ISR runs at a fixed rate of FTM_STEPS_PER_FRAME calls
+ * per frame and only spreads the steps of the frame evenly over those calls.
+ *
+ * Blocks stay in the planner buffer until the stepper has played their last
+ * frame, so the planner sees them as busy just like with the standard ISR.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "planner.h"
+
+// Stepper timer ticks between the ISR calls, and the time of a frame as played
+#define FTM_ISR_TICKS   ((STEPPER_TIMER_RATE) / ((FTM_FRAME_RATE) * (FTM_STEPS_PER_FRAME)))
+#define FTM_FRAME_TIME  (float(FTM_ISR_TICKS) * (FTM_STEPS_PER_FRAME) / (STEPPER_TIMER_RATE))
+
+#if ENABLED(FTM_STEP_DMA)
+  // Pattern words per frame: the DIR word, then a STEP on and a STEP off word per slot
+  #define FTM_DMA_WORDS        (1 + 2 * (FTM_STEPS_PER_FRAME))
+  #define FTM_DMA_RATE         ((FTM_DMA_WORDS) * (FTM_FRAME_RATE))
+  // Stepper timer ticks between the checks for a played half of the pattern buffer
+  #define FTM_DMA_CHECK_TICKS  ((STEPPER_TIMER_RATE) / (FTM_FRAME_RATE) / 2)
+#endif
+
+#if ENABLED(SMOOTH_LIN_ADVANCE)
+  #define FTM_ADVANCE_MAX_TIME  0.1f                    // (s) Longest time to average the E speed over
+  #define FTM_ADVANCE_HALF_MAX  ((FTM_FRAME_RATE) / 20) // Frames in half of that time
+#endif
+
+#if ENABLED(FTM_CURVE_BLOCKS)
+
+  #define FTM_CURVE_SAMPLES 32              // Pieces of the Bézier length table
+
+  /**
+   * A G2/G3 arc or G5 Bézier in the plane of two axes, queued as a single
+   * planner block. Points are in mm from the start of the curve and are found
+   * by the fraction of its length done, so the other axes move in proportion.
+   */
+  struct ft_curve_t {
+    AxisEnum axis_p, axis_q;                // The plane of the curve
+    bool bezier;
+    xy_float_t center;                      // Arc: Center
+    float angle,                            // Arc: Rotation in radians, positive is counterclockwise
+          grow;                             // Arc: End radius over start radius, minus 1
+    xy_float_t ctrl[3];                     // Bézier: Control points and end point
+    float length[FTM_CURVE_SAMPLES];        // Bézier: Length up to the end of each piece
+    float planar_mm,                        // Length in the plane
+          min_radius;                       // Tightest radius of curvature
+    xy_float_t start_dir, end_dir;          // Unit tangents at the ends
+    xy_long_t chord;                        // Steps from start to end. Set by the planner.
+
+    void set_arc(const AxisEnum p, const AxisEnum q, const xy_float_t &c, const float a, const float end_radius);
+    void set_bezier(const xy_float_t &c1, const xy_float_t &c2, const xy_float_t &end);
+    void set_bezier_part(const ft_curve_t &whole, const uint8_t i0, const uint8_t i1);
+    uint8_t bezier_cuts(const float max_radius, uint8_t (&cut)[FTM_CURVE_SAMPLES + 1]) const;
+
+    // Bézier point at parameter t, and the length up to the start of piece i
+    xy_float_t at(const float t) const;
+    float length_to(const uint8_t i) const { return i ? length[i - 1] : 0; }
+
+    // Point at the given fraction of the length
+    xy_float_t point(const float s) const;
+
+    // True if the curve stays within the soft endstops
+    bool within_limits(const xyz_pos_t &start) const;
+
+    // Turn the plane part of a start vector to the end direction
+    void turn_to_end(xyze_float_t &v) const {
+      const float m = HYPOT(v[axis_p], v[axis_q]);
+      v[axis_p] = end_dir.x * m;
+      v[axis_q] = end_dir.y * m;
+    }
+
+  private:
+    float bend_radius(const float t) const;
+    float piece_radius(const uint8_t i) const;
+  };
+
+#endif
+
+typedef struct {
+  uint8_t steps[LOGICAL_AXES];              // Steps to take on each axis in this frame
+  axis_bits_t dir_bits,                     // Directions, as in Stepper::last_direction_bits
+              move_bits;                    // Axes moving in this frame, for the endstop checks
+  uint8_t blocks_done;                      // Planner blocks that end in this frame
+  #if HAS_MULTI_EXTRUDER
+    uint8_t extruder;                       // The extruder to step
+  #endif
+} ft_frame_t;
+
+class FTMotion {
+  public:
+    static bool active;                     // Fixed-Time Motion replaces the standard stepper ISR
+
+    // Frames computed by loop() and played by Stepper::ft_motion_isr()
+    static ft_frame_t frames[FTM_BUFFER_FRAMES];
+    static volatile uint8_t frame_head, frame_tail;
+    #if ENABLED(FTM_STEP_DMA)
+      static volatile uint8_t dma_frames;   // Frames taken from the buffer but not yet played by the DMA
+    #endif
+
+    // Switch modes once the queued moves are done
+    static void set_active(const bool on);
+
+    // Compute frames while there is room. Called from idle().
+    static void loop();
+
+    // True while moves are still to be played
+    static bool busy() { return active && (block || frame_head != frame_tail || TERN0(FTM_STEP_DMA, dma_frames) || !caught_up()); }
+
+    // Drop all the frames, for an endstop hit or quick_stop. Called from the stepper ISR.
+    static void abort() { frame_tail = frame_head; aborted = true; }
+
+    #if ENABLED(FTM_CURVE_BLOCKS)
+      static ft_curve_t curves[BLOCK_BUFFER_SIZE];  // Curves of the planner blocks, by block index
+
+      // True if a curve can go to the planner as a single block
+      static bool curves_ok() { return active && !TERN0(HAS_LEVELING, planner.leveling_active); }
+    #endif
+
+    #if ENABLED(SMOOTH_LIN_ADVANCE)
+      // Time to average the E speed over for the advance. Waits for the moves to finish.
+      static float get_advance_time() { return advance_time; }
+      static void set_advance_time(const float t);
+    #endif
+
+    static uint8_t next_frame_index(const uint8_t i) { return i + 1 < (FTM_BUFFER_FRAMES) ? i + 1 : 0; }
+
+    static uint8_t frames_queued() {
+      const uint8_t head = frame_head, tail = frame_tail;
+      return head >= tail ? head - tail : head + (FTM_BUFFER_FRAMES) - tail;
+    }
+
+  private:
+    static volatile bool aborted;           // Frames were dropped, so start over
+
+    static block_t *block;                  // The block being turned into frames
+    static float block_time,                // Time spent in the block so far
+                 ratio[LOGICAL_AXES];       // Signed steps on each axis per step event
+    #if ENABLED(FTM_CURVE_BLOCKS)
+      static const ft_curve_t *curve;       // The curve of the block, if any
+    #endif
+    static struct profile_t {
+      float accel, initial_rate, cruise_rate,
+            accel_time, cruise_time, total_time,
+            accel_events, cruise_events;
+    } profile;
+
+    static abce_long_t base,                // Steps at the start of the block
+                       target,              // Steps the motion has reached
+                       emitted;             // Steps put in frames so far
+    static axis_bits_t dir_bits,            // Directions of the axes
+                       block_bits;          // Axes moving in the current block
+    static uint8_t blocks_done;             // Blocks ended in the frame being built
+    #if HAS_MULTI_EXTRUDER
+      static uint8_t extruder;
+    #endif
+
+    #if ENABLED(SMOOTH_LIN_ADVANCE)
+      /**
+       * The frames play the motion half the averaging time late, so the E speed
+       * is averaged over a window centered on the frame being played.
+       */
+      static float advance_time;
+      static uint8_t advance_half,          // Frames the output runs behind the motion
+                     delay_index, lead_index,
+                     unsettled;             // Frames until the delay lines hold only the last position
+      static int32_t lead_base, lead;       // E steps of the moves that use the advance
+      static struct delayed_t {
+        abce_long_t pos;
+        axis_bits_t move_bits;
+        uint8_t blocks_done;
+      } delayed[FTM_ADVANCE_HALF_MAX + 1];  // The motion of the last frames, to play late
+      static int32_t lead_hist[2 * (FTM_ADVANCE_HALF_MAX) + 1];
+
+      static void clear_advance();
+      static void advance_frame(abce_long_t &pos, axis_bits_t &move_bits, uint8_t &done);
+    #endif
+
+    // True when the frames have every step the motion has reached
+    static bool caught_up() {
+      if (TERN0(SMOOTH_LIN_ADVANCE, unsettled)) return false;
+      LOOP_LOGICAL_AXES(a) if (target[a] != emitted[a]) return false;
+      return true;
+    }
+
+    static void reset();
+    static bool next_block();
+    static bool next_move();
+    static void start_block(block_t * const b);
+    static void end_block();
+    static float block_events(const float t);
+    #if ENABLED(FTM_CURVE_BLOCKS)
+      static void trace_curve(const float events);
+    #endif
+    static bool make_frame();
+};
+
+extern FTMotion ftMotion;
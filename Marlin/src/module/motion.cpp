@@ -957,6 +957,35 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     #define SCARA_MIN_SEGMENT_LENGTH 0.5f
   #endif
 
+  #if ENABLED(KINEMATIC_ADAPTIVE_SEGMENTS)
+
+    /**
+     * Get the fewest segments that keep a move within KINEMATIC_SEGMENT_TOLERANCE.
+     *
+     * The joints go straight from one segment end to the next, so each segment
+     * strays from the line by the bend of the joint path. Inverse kinematics at the
+     * quarter points give the second difference of each joint, which is 1/16 the
+     * bend of the whole move. A segment 1/n of the move strays bend / (8 n²), so
+     * n² = 2 * difference / tolerance.
+     */
+    static float kinematic_segments(const xyze_pos_t &start, const xyze_float_t &diff) {
+      abce_pos_t q[5];
+      LOOP_L_N(i, 5) {
+        inverse_kinematics(start + diff * (0.25f * i));
+        q[i] = delta;
+      }
+      float bend = 0;
+      for (uint8_t i = 1; i < 4; ++i)
+        LOOP_ABC(a) NOLESS(bend, ABS(q[i - 1][a] - 2 * q[i][a] + q[i + 1][a]));
+
+      // SCARA joints are in degrees, so get their travel at the arm tip
+      TERN_(IS_SCARA, bend = RADIANS(bend) * (L1 + L2));
+
+      return CEIL(SQRT(2.0f * bend / float(KINEMATIC_SEGMENT_TOLERANCE)));
+    }
+
+  #endif
+
   /**
    * Prepare a linear move in a DELTA or SCARA setup.
    *
@@ -1004,6 +1033,15 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     // gives the number of segments
     uint16_t segments = segments_per_second * seconds;
 
+    // Use fewer segments where the joints move almost linearly.
+    // It takes 5 inverse kinematics to find out, so skip short moves.
+    #if ENABLED(KINEMATIC_ADAPTIVE_SEGMENTS)
+      if (segments > 4) {
+        const float fewest = kinematic_segments(current_position, diff);
+        if (fewest < segments) segments = fewest;   // False for NaN where the line leaves the work area
+      }
+    #endif
+
     // For SCARA enforce a minimum segment size
     #if IS_SCARA
       NOMORE(segments, cartesian_mm * RECIPROCAL(SCARA_MIN_SEGMENT_LENGTH));
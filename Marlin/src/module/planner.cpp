@@ -110,6 +110,10 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(FT_MOTION)
+  #include "ft_motion.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
@@ -122,6 +126,7 @@ Planner planner;
  * A ring buffer of moves described in steps
  */
 block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
+block_junction_t Planner::junction;
 volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be pushed
                  Planner::block_buffer_nonbusy, // Index of the first non-busy block
                  Planner::block_buffer_planned, // Index of the optimally planned block
@@ -238,7 +243,17 @@ float Planner::previous_nominal_speed;
   xyze_pos_t Planner::position_cart;
 #endif
 
-#if HAS_WIRED_LCD
+#if HAS_HELD_MOVE
+  Planner::held_move_t Planner::held;
+#endif
+#if ENABLED(COALESCE_SEGMENTS)
+  uint32_t Planner::coalesce_moves, Planner::coalesce_blocks; // = 0
+#endif
+#if ENABLED(PATH_BLENDING)
+  float Planner::blend_tolerance; // = 0
+#endif
+
+#if HAS_BLOCK_RUNTIME
   volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
@@ -750,7 +765,7 @@ block_t* Planner::get_current_block() {
     if (block->flag.recalculate) return nullptr;
 
     // We can't be sure how long an active block will take, so don't count it.
-    TERN_(HAS_WIRED_LCD, block_buffer_runtime_us -= block->segment_time_us);
+    TERN_(HAS_BLOCK_RUNTIME, block_buffer_runtime_us -= block->segment_time_us);
 
     // As this block is busy, advance the nonbusy block pointer
     block_buffer_nonbusy = next_block_index(block_buffer_tail);
@@ -764,11 +779,76 @@ block_t* Planner::get_current_block() {
   }
 
   // The queue became empty
-  TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
+  TERN_(HAS_BLOCK_RUNTIME, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
 
   return nullptr;
 }
 
+#if ENABLED(FT_MOTION)
+
+  block_t* Planner::get_next_block() {
+    if (block_buffer_nonbusy == block_buffer_head) return nullptr;
+
+    // Hold the first move of a new batch, as get_current_block() does
+    if (delay_before_delivering && block_buffer_nonbusy == block_buffer_tail) {
+      --delay_before_delivering;
+      if (movesplanned() < 3 && delay_before_delivering) return nullptr;
+      delay_before_delivering = 0;
+    }
+
+    block_t * const block = &block_buffer[block_buffer_nonbusy];
+
+    // No trapezoid calculated? Don't execute yet.
+    if (block->flag.recalculate) return nullptr;
+
+    TERN_(HAS_BLOCK_RUNTIME, block_buffer_runtime_us -= block->segment_time_us);
+
+    // Push block_buffer_planned pointer, if encountered.
+    if (block_buffer_nonbusy == block_buffer_planned)
+      block_buffer_planned = next_block_index(block_buffer_nonbusy);
+
+    block_buffer_nonbusy = next_block_index(block_buffer_nonbusy);
+    return block;
+  }
+
+#endif
+
+#ifdef S_CURVE_MAX_JERK
+
+  // The peak jerk of the Bézier speed curve is 10/√3 times its speed change over its time squared
+  #define S_CURVE_JERK_FACTOR 5.7735027f
+
+  /**
+   * Get the time of an S-curve speed change of dv, keeping to the average
+   * acceleration and the peak jerk. Any units, as long as they agree.
+   */
+  float Planner::s_curve_time(const_float_t dv, const_float_t accel, const_float_t jerk) {
+    return _MAX(dv / accel, SQRT(S_CURVE_JERK_FACTOR * dv / jerk));
+  }
+
+  /**
+   * Get the highest speed squared from which the S-curve reaches 'target_velocity_sqr'
+   * within 'distance'. For large speed changes the acceleration is the limit, as
+   * with the trapezoid. For smaller ones the time goes with √dv, which gives a cubic
+   * in s = √dv:  s³ + 2vs = 2 * distance * √(jerk / k)
+   */
+  float Planner::s_curve_speed_sqr(const_float_t accel, const_float_t target_velocity_sqr, const_float_t distance, const_float_t jerk) {
+    if (distance <= 0) return target_velocity_sqr;
+
+    const float v = SQRT(target_velocity_sqr),
+                dv_accel = S_CURVE_JERK_FACTOR * sq(accel) / jerk;  // The speed change where acceleration takes over
+    if (distance >= (v + 0.5f * dv_accel) * dv_accel / accel)
+      return target_velocity_sqr + 2 * accel * distance;
+
+    // Cardano's formula. The second cube root is -p / 3 over the first.
+    const float p = 2 * v, r = 2 * distance * SQRT(jerk / S_CURVE_JERK_FACTOR),
+                u = cbrtf(0.5f * r + SQRT(0.25f * sq(r) + p * p * p * (1.0f / 27))),
+                s = u - p / (3 * u);
+    return sq(v + sq(s));
+  }
+
+#endif
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors.
@@ -800,6 +880,43 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   uint32_t accelerate_steps = 0,
            decelerate_steps = 0;
 
+  #ifdef S_CURVE_MAX_JERK
+
+    // The jerk in steps/s³. Small speed changes are stretched in time to keep to it,
+    // so the steps of each change come from its time instead of the trapezoid.
+    const float jerk = float(S_CURVE_MAX_JERK) * block->step_event_count / junction.millimeters[block - block_buffer];
+    auto change_steps = [&](const float v0, const float v1) {
+      return 0.5f * (v0 + v1) * s_curve_time(ABS(v1 - v0), accel, jerk);
+    };
+
+    if (accel != 0) {
+      accelerate_steps = CEIL(change_steps(initial_rate, cruise_rate));
+      decelerate_steps = FLOOR(change_steps(cruise_rate, final_rate));
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      // Too short to reach the nominal rate? Search for the top rate that fits.
+      // It is no higher than the peak of the trapezoid, which fits if both
+      // speed changes are big enough to be limited by acceleration alone.
+      if (plateau_steps < 0) {
+        float lo = _MAX(initial_rate, final_rate),
+              hi = SQRT(float(accel) * block->step_event_count + 0.5f * (sq(float(initial_rate)) + sq(float(final_rate))));
+        if (hi < cruise_rate && hi - lo >= S_CURVE_JERK_FACTOR * sq(float(accel)) / jerk)
+          lo = hi;
+        else {
+          NOMORE(hi, cruise_rate);
+          LOOP_L_N(i, 8) {
+            const float mid = 0.5f * (lo + hi);
+            if (change_steps(initial_rate, mid) + change_steps(mid, final_rate) > block->step_event_count) hi = mid; else lo = mid;
+          }
+        }
+        cruise_rate = lo;
+        accelerate_steps = _MIN(uint32_t(LROUND(change_steps(initial_rate, cruise_rate))), block->step_event_count);
+        decelerate_steps = block->step_event_count - accelerate_steps;
+      }
+    }
+
+  #else
+
   if (accel != 0) {
     // Steps required for acceleration, deceleration to/from nominal rate
     const float nominal_rate_sq = sq(float(block->nominal_rate));
@@ -827,13 +944,21 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
     }
   }
 
+  #endif // !S_CURVE_MAX_JERK
+
   #if ENABLED(S_CURVE_ACCELERATION)
     // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = (float(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
-             deceleration_time = (float(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE),
+    #ifdef S_CURVE_MAX_JERK
+      #define _CHANGE_TIME(V0, V1) s_curve_time(float((V0) - (V1)), accel, jerk)
+    #else
+      #define _CHANGE_TIME(V0, V1) (float((V0) - (V1)) / accel)
+    #endif
+    uint32_t acceleration_time = _CHANGE_TIME(cruise_rate, initial_rate) * (STEPPER_TIMER_RATE),
+             deceleration_time = _CHANGE_TIME(cruise_rate, final_rate) * (STEPPER_TIMER_RATE),
     // And to offload calculations from the ISR, we also calculate the inverse of those times here
              acceleration_time_inverse = get_period_inverse(acceleration_time),
              deceleration_time_inverse = get_period_inverse(deceleration_time);
+    #undef _CHANGE_TIME
   #endif
 
   // Store new block parameters
@@ -970,61 +1095,65 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
 */
 
 // The kernel called by recalculate() when scanning the plan from last to first entry.
-void Planner::reverse_pass_kernel(block_t * const current, const block_t * const next
-  OPTARG(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)
-) {
-  if (current) {
-    // If entry speed is already at the maximum entry speed, and there was no change of speed
-    // in the next block, there is no need to recheck. Block is cruising and there is no need to
-    // compute anything for this block,
-    // If not, block entry speed needs to be recalculated to ensure maximum possible planned speed.
-    const float max_entry_speed_sqr = current->max_entry_speed_sqr;
-
-    // Compute maximum entry speed decelerating over the current block from its exit speed.
-    // If not at the maximum entry speed, or the previous block entry speed changed
-    if (current->entry_speed_sqr != max_entry_speed_sqr || (next && next->flag.recalculate)) {
-
-      // If nominal length true, max junction speed is guaranteed to be reached.
-      // If a block can de/ac-celerate from nominal speed to zero within the length of the block, then
-      // the current block and next block junction speeds are guaranteed to always be at their maximum
-      // junction speeds in deceleration and acceleration, respectively. This is due to how the current
-      // block nominal speed limits both the current and next maximum junction speeds. Hence, in both
-      // the reverse and forward planners, the corresponding block junction speed will always be at the
-      // the maximum junction speed and may always be ignored for any speed reduction checks.
-
-      const float next_entry_speed_sqr = next ? next->entry_speed_sqr : _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr), sq(float(MINIMUM_PLANNER_SPEED))),
-                  new_entry_speed_sqr = current->flag.nominal_length
-                    ? max_entry_speed_sqr
-                    : _MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-current->acceleration, next_entry_speed_sqr, current->millimeters));
-      if (current->entry_speed_sqr != new_entry_speed_sqr) {
-
-        // Need to recalculate the block speed - Mark it now, so the stepper
-        // ISR does not consume the block before being recalculated
-        current->flag.recalculate = true;
-
-        // But there is an inherent race condition here, as the block may have
-        // become BUSY just before being marked RECALCULATE, so check for that!
-        if (stepper.is_block_busy(current)) {
-          // Block became busy. Clear the RECALCULATE flag (no point in
-          // recalculating BUSY blocks). And don't set its speed, as it can't
-          // be updated at this time.
-          current->flag.recalculate = false;
-        }
-        else {
-          // Block is not BUSY so this is ahead of the Stepper ISR:
-          // Just Set the new entry speed.
-          current->entry_speed_sqr = new_entry_speed_sqr;
-        }
-      }
-    }
+// Return true if the entry speed of the block was changed.
+bool Planner::reverse_pass_kernel(const uint8_t index, const_float_t next_entry_speed_sqr, const bool next_changed) {
+  // If entry speed is already at the maximum entry speed, and there was no change of speed
+  // in the next block, there is no need to recheck. Block is cruising and there is no need to
+  // compute anything for this block,
+  // If not, block entry speed needs to be recalculated to ensure maximum possible planned speed.
+  float &entry_speed_sqr = junction.entry_speed_sqr[index];
+  const float max_entry_speed_sqr = junction.max_entry_speed_sqr[index];
+
+  // Compute maximum entry speed decelerating over the current block from its exit speed.
+  // If not at the maximum entry speed, or the previous block entry speed changed
+  if (entry_speed_sqr == max_entry_speed_sqr && !next_changed) return false;
+
+  block_t * const current = &block_buffer[index];
+
+  // If nominal length true, max junction speed is guaranteed to be reached.
+  // If a block can de/ac-celerate from nominal speed to zero within the length of the block, then
+  // the current block and next block junction speeds are guaranteed to always be at their maximum
+  // junction speeds in deceleration and acceleration, respectively. This is due to how the current
+  // block nominal speed limits both the current and next maximum junction speeds. Hence, in both
+  // the reverse and forward planners, the corresponding block junction speed will always be at the
+  // the maximum junction speed and may always be ignored for any speed reduction checks.
+  const float new_entry_speed_sqr = current->flag.nominal_length
+    ? max_entry_speed_sqr
+    : _MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-junction.acceleration[index], next_entry_speed_sqr, junction.millimeters[index]));
+
+  if (entry_speed_sqr == new_entry_speed_sqr) return false;
+
+  // Need to recalculate the block speed - Mark it now, so the stepper
+  // ISR does not consume the block before being recalculated
+  current->flag.recalculate = true;
+
+  // But there is an inherent race condition here, as the block may have
+  // become BUSY just before being marked RECALCULATE, so check for that!
+  if (stepper.is_block_busy(current)) {
+    // Block became busy. Clear the RECALCULATE flag (no point in
+    // recalculating BUSY blocks). And don't set its speed, as it can't
+    // be updated at this time.
+    current->flag.recalculate = false;
+    return false;
   }
+
+  // Block is not BUSY so this is ahead of the Stepper ISR:
+  // Just Set the new entry speed.
+  entry_speed_sqr = new_entry_speed_sqr;
+  return true;
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the reverse pass.
+ *
+ * The pass stops at the first block (other than the newest) whose entry speed
+ * doesn't change. The blocks before it see the same exit speeds as when they were
+ * last planned, so their plan can't change either.
+ *
+ * Return the index of the block where the pass stopped, for the forward pass.
  */
-void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
+uint8_t Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
   // Initialize block index to the last block in the planner buffer.
   uint8_t block_index = prev_block_index(block_buffer_head);
 
@@ -1035,11 +1164,12 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
   // If there was a race condition and block_buffer_planned was incremented
   //  or was pointing at the head (queue empty) break loop now and avoid
   //  planning already consumed blocks
-  if (planned_block_index == block_buffer_head) return;
+  if (planned_block_index == block_buffer_head) return planned_block_index;
 
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
   // NOTE: Forward pass will later refine and correct the reverse pass to create an optimal plan.
+  float next_entry_speed_sqr = _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr), sq(float(MINIMUM_PLANNER_SPEED)));
   const block_t *next = nullptr;
   while (block_index != planned_block_index) {
 
@@ -1048,8 +1178,13 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
 
     // Only process movement blocks
     if (current->is_move()) {
-      reverse_pass_kernel(current, next OPTARG(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
+      const bool changed = reverse_pass_kernel(block_index, next_entry_speed_sqr, next && next->flag.recalculate);
+
+      // The rest of the plan is already optimal
+      if (!changed && next) return block_index;
+
       next = current;
+      next_entry_speed_sqr = junction.entry_speed_sqr[block_index];
     }
 
     // Advance to the next
@@ -1061,68 +1196,75 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
     while (planned_block_index != block_buffer_planned) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == planned_block_index) return;
+      if (block_index == planned_block_index) return planned_block_index;
 
       // Advance the pointer, following the busy block
       planned_block_index = next_block_index(planned_block_index);
     }
   }
+
+  return planned_block_index;
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
-void Planner::forward_pass_kernel(const block_t * const previous, block_t * const current, const uint8_t block_index) {
-  if (previous) {
-    // If the previous block is an acceleration block, too short to complete the full speed
-    // change, adjust the entry speed accordingly. Entry speeds have already been reset,
-    // maximized, and reverse-planned. If nominal length is set, max junction speed is
-    // guaranteed to be reached. No need to recheck.
-    if (!previous->flag.nominal_length && previous->entry_speed_sqr < current->entry_speed_sqr) {
-
-      // Compute the maximum allowable speed
-      const float new_entry_speed_sqr = max_allowable_speed_sqr(-previous->acceleration, previous->entry_speed_sqr, previous->millimeters);
-
-      // If true, current block is full-acceleration and we can move the planned pointer forward.
-      if (new_entry_speed_sqr < current->entry_speed_sqr) {
-
-        // Mark we need to recompute the trapezoidal shape, and do it now,
-        // so the stepper ISR does not consume the block before being recalculated
-        current->flag.recalculate = true;
-
-        // But there is an inherent race condition here, as the block maybe
-        // became BUSY, just before it was marked as RECALCULATE, so check
-        // if that is the case!
-        if (stepper.is_block_busy(current)) {
-          // Block became busy. Clear the RECALCULATE flag (no point in
-          //  recalculating BUSY blocks and don't set its speed, as it can't
-          //  be updated at this time.
-          current->flag.recalculate = false;
-        }
-        else {
-          // Block is not BUSY, we won the race against the Stepper ISR:
+void Planner::forward_pass_kernel(const uint8_t previous, const uint8_t current) {
+  // If the previous block is an acceleration block, too short to complete the full speed
+  // change, adjust the entry speed accordingly. Entry speeds have already been reset,
+  // maximized, and reverse-planned. If nominal length is set, max junction speed is
+  // guaranteed to be reached. No need to recheck.
+  float &entry_speed_sqr = junction.entry_speed_sqr[current];
+  const float previous_entry_speed_sqr = junction.entry_speed_sqr[previous];
+  if (!block_buffer[previous].flag.nominal_length && previous_entry_speed_sqr < entry_speed_sqr) {
+
+    // Compute the maximum allowable speed
+    const float new_entry_speed_sqr = max_allowable_speed_sqr(-junction.acceleration[previous], previous_entry_speed_sqr, junction.millimeters[previous]);
+
+    // If true, current block is full-acceleration and we can move the planned pointer forward.
+    if (new_entry_speed_sqr < entry_speed_sqr) {
+
+      block_t * const block = &block_buffer[current];
+
+      // Mark we need to recompute the trapezoidal shape, and do it now,
+      // so the stepper ISR does not consume the block before being recalculated
+      block->flag.recalculate = true;
+
+      // But there is an inherent race condition here, as the block maybe
+      // became BUSY, just before it was marked as RECALCULATE, so check
+      // if that is the case!
+      if (stepper.is_block_busy(block)) {
+        // Block became busy. Clear the RECALCULATE flag (no point in
+        //  recalculating BUSY blocks and don't set its speed, as it can't
+        //  be updated at this time.
+        block->flag.recalculate = false;
+      }
+      else {
+        // Block is not BUSY, we won the race against the Stepper ISR:
 
-          // Always <= max_entry_speed_sqr. Backward pass sets this.
-          current->entry_speed_sqr = new_entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
+        // Always <= max_entry_speed_sqr. Backward pass sets this.
+        entry_speed_sqr = new_entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
 
-          // Set optimal plan pointer.
-          block_buffer_planned = block_index;
-        }
+        // Set optimal plan pointer.
+        block_buffer_planned = current;
       }
     }
-
-    // Any block set at its maximum entry speed also creates an optimal plan up to this
-    // point in the buffer. When the plan is bracketed by either the beginning of the
-    // buffer and a maximum entry speed or two maximum entry speeds, every block in between
-    // cannot logically be further improved. Hence, we don't have to recompute them anymore.
-    if (current->entry_speed_sqr == current->max_entry_speed_sqr)
-      block_buffer_planned = block_index;
   }
+
+  // Any block set at its maximum entry speed also creates an optimal plan up to this
+  // point in the buffer. When the plan is bracketed by either the beginning of the
+  // buffer and a maximum entry speed or two maximum entry speeds, every block in between
+  // cannot logically be further improved. Hence, we don't have to recompute them anymore.
+  if (entry_speed_sqr == junction.max_entry_speed_sqr[current])
+    block_buffer_planned = current;
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the forward pass.
+ *
+ * Blocks before start_index (where the reverse pass stopped) kept their entry
+ * speeds, so the pass begins there.
  */
-void Planner::forward_pass() {
+void Planner::forward_pass(const uint8_t start_index) {
 
   // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
   // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
@@ -1133,12 +1275,16 @@ void Planner::forward_pass() {
   //  pass will never modify the values at the tail.
   uint8_t block_index = block_buffer_planned;
 
-  block_t *block;
-  const block_t * previous = nullptr;
+  // Skip ahead to the start index, unless the ISR has already gone past it
+  if (BLOCK_MOD(start_index - block_index) < BLOCK_MOD(block_buffer_head - block_index))
+    block_index = start_index;
+
+  const block_t *previous = nullptr;
+  uint8_t previous_index = 0;
   while (block_index != block_buffer_head) {
 
     // Perform the forward pass
-    block = &block_buffer[block_index];
+    block_t * const block = &block_buffer[block_index];
 
     // Only process movement blocks
     if (block->is_move()) {
@@ -1147,9 +1293,10 @@ void Planner::forward_pass() {
       // the previous block became BUSY, so assume the current block's
       // entry speed can't be altered (since that would also require
       // updating the exit speed of the previous block).
-      if (!previous || !stepper.is_block_busy(previous))
-        forward_pass_kernel(previous, block, block_index);
+      if (previous && !stepper.is_block_busy(previous))
+        forward_pass_kernel(previous_index, block_index);
       previous = block;
+      previous_index = block_index;
     }
     // Advance to the previous
     block_index = next_block_index(block_index);
@@ -1160,11 +1307,22 @@ void Planner::forward_pass() {
  * Recalculate the trapezoid speed profiles for all blocks in the plan
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
+ *
+ * Only blocks marked RECALCULATE are visited in full, so the square roots
+ * of the junction speeds are only taken for the blocks that changed.
+ *
+ * The scan begins at start_index, where the reverse pass stopped. The passes
+ * didn't change any speeds before it, so the blocks there keep their trapezoids.
  */
-void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
+void Planner::recalculate_trapezoids(const uint8_t start_index OPTARG(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
   // The tail may be changed by the ISR so get a local copy.
   uint8_t block_index = block_buffer_tail,
           head_block_index = block_buffer_head;
+
+  // Skip ahead to the start index, unless the ISR has already gone past it
+  if (BLOCK_MOD(start_index - block_index) < BLOCK_MOD(head_block_index - block_index))
+    block_index = start_index;
+
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
   // specially handled), scan backwards to the first non-SYNC block.
@@ -1183,17 +1341,29 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
     head_block_index = prev_index;
   }
 
+  // Recalculate the trapezoid of a block from its entry and exit speeds
+  auto trapezoid = [](block_t * const block, const_float_t entry_speed, const_float_t exit_speed) {
+    // NOTE: Entry and exit factors always > 0 by all previous logic operations.
+    const float nomr = 1.0f / block->nominal_speed;
+    calculate_trapezoid_for_block(block, entry_speed * nomr, exit_speed * nomr);
+    #if ENABLED(LIN_ADVANCE)
+      if (block->use_advance_lead) {
+        const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+        block->max_adv_steps = block->nominal_speed * comp;
+        block->final_adv_steps = exit_speed * comp;
+      }
+    #endif
+  };
+
   // Go from the tail (currently executed block) to the first block, without including it)
   block_t *block = nullptr, *next = nullptr;
-  float current_entry_speed = 0.0f, next_entry_speed = 0.0f;
+  uint8_t current_index = 0;
   while (block_index != head_block_index) {
 
     next = &block_buffer[block_index];
 
     // Only process movement blocks
     if (next->is_move()) {
-      next_entry_speed = SQRT(next->entry_speed_sqr);
-
       if (block) {
 
         // If the next block is marked to RECALCULATE, also mark the previously-fetched one
@@ -1207,17 +1377,7 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
           // if that is the case!
           if (!stepper.is_block_busy(block)) {
             // Block is not BUSY, we won the race against the Stepper ISR:
-
-            // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-            const float nomr = 1.0f / block->nominal_speed;
-            calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
-            #if ENABLED(LIN_ADVANCE)
-              if (block->use_advance_lead) {
-                const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-                block->max_adv_steps = block->nominal_speed * comp;
-                block->final_adv_steps = next_entry_speed * comp;
-              }
-            #endif
+            trapezoid(block, SQRT(junction.entry_speed_sqr[current_index]), SQRT(junction.entry_speed_sqr[block_index]));
           }
 
           // Reset current only to ensure next trapezoid is computed - The
@@ -1227,7 +1387,7 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
       }
 
       block = next;
-      current_entry_speed = next_entry_speed;
+      current_index = block_index;
     }
 
     block_index = next_block_index(block_index);
@@ -1236,7 +1396,7 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
   // Last/newest block in buffer. Always recalculated.
   if (block) {
     // Exit speed is set with MINIMUM_PLANNER_SPEED unless some code higher up knows better.
-    next_entry_speed = _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, SQRT(safe_exit_speed_sqr)), float(MINIMUM_PLANNER_SPEED));
+    const float next_entry_speed = _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, SQRT(safe_exit_speed_sqr)), float(MINIMUM_PLANNER_SPEED));
 
     // Mark the next(last) block as RECALCULATE, to prevent the Stepper ISR running it.
     // As the last block is always recalculated here, there is a chance the block isn't
@@ -1248,16 +1408,7 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
     // if that is the case!
     if (!stepper.is_block_busy(block)) {
       // Block is not BUSY, we won the race against the Stepper ISR:
-
-      const float nomr = 1.0f / block->nominal_speed;
-      calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
-      #if ENABLED(LIN_ADVANCE)
-        if (block->use_advance_lead) {
-          const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-          block->max_adv_steps = block->nominal_speed * comp;
-          block->final_adv_steps = next_entry_speed * comp;
-        }
-      #endif
+      trapezoid(block, SQRT(junction.entry_speed_sqr[current_index]), next_entry_speed);
     }
 
     // Reset block to ensure its trapezoid is computed - The stepper is free to use
@@ -1268,13 +1419,13 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
 
 void Planner::recalculate(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
   // Initialize block index to the last block in the planner buffer.
-  const uint8_t block_index = prev_block_index(block_buffer_head);
+  uint8_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
   if (block_index != block_buffer_planned) {
-    reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
-    forward_pass();
+    block_index = reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
+    forward_pass(block_index);
   }
-  recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
+  recalculate_trapezoids(block_index OPTARG(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
 }
 
 /**
@@ -1680,13 +1831,14 @@ void Planner::quick_stop() {
   const bool was_enabled = stepper.suspend();
 
   // Drop all queue entries
+  TERN_(HAS_HELD_MOVE, held.count = 0);
   block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail;
 
   // Restart the block delay for the first movement - As the queue was
   // forced to empty, there's no risk the ISR will touch this.
   delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
 
-  TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // Clear the accumulated runtime
+  TERN_(HAS_BLOCK_RUNTIME, clear_block_buffer_runtime()); // Clear the accumulated runtime
 
   // Make sure to drop any attempt of queuing moves for 1 second
   cleaning_buffer_counter = TEMP_TIMER_FREQUENCY;
@@ -1727,6 +1879,7 @@ float Planner::triggered_position_mm(const AxisEnum axis) {
 }
 
 void Planner::finish_and_disable() {
+  TERN_(HAS_HELD_MOVE, release_held_move());
   while (has_blocks_queued() || cleaning_buffer_counter) idle();
   stepper.disable_all_steppers();
 }
@@ -1787,7 +1940,19 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 /**
  * Block until the planner is finished processing
  */
-void Planner::synchronize() { while (busy()) idle(); }
+bool Planner::busy() {
+  return (has_blocks_queued() || cleaning_buffer_counter
+      || TERN0(HAS_HELD_MOVE, held.count)
+      || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
+      || TERN0(HAS_SHAPING, stepper.shaping_busy())
+      || TERN0(FT_MOTION, ftMotion.busy())
+  );
+}
+
+void Planner::synchronize() {
+  TERN_(HAS_HELD_MOVE, release_held_move());
+  while (busy()) idle();
+}
 
 /**
  * @brief Add a new linear movement to the planner queue (in terms of steps).
@@ -1871,6 +2036,11 @@ bool Planner::_populate_block(
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints
 ) {
+  // Lookahead data of the new block
+  const uint8_t bindex = block_index(block);
+  float &millimeters = junction.millimeters[bindex],
+        &acceleration = junction.acceleration[bindex];
+
   int32_t LOGICAL_AXIS_LIST(
     de = target.e - position.e,
     da = target.a - position.a,
@@ -2105,6 +2275,25 @@ bool Planner::_populate_block(
     steps_dist_mm.k = dk * mm_per_step[K_AXIS]
   );
 
+  #if ENABLED(FTM_CURVE_BLOCKS)
+    /**
+     * A curve moves its plane axes along its whole length, so that is their
+     * step count. Their distances point along the start of the curve, where
+     * it joins the previous block.
+     */
+    if (hints.curve) {
+      ft_curve_t &curve = FTMotion::curves[bindex];
+      curve = *hints.curve;
+      const AxisEnum p = curve.axis_p, q = curve.axis_q;
+      curve.chord.set(target[p] - position[p], target[q] - position[q]);
+      block->steps[p] = CEIL(curve.planar_mm * settings.axis_steps_per_mm[p]);
+      block->steps[q] = CEIL(curve.planar_mm * settings.axis_steps_per_mm[q]);
+      steps_dist_mm[p] = curve.start_dir.x * curve.planar_mm;
+      steps_dist_mm[q] = curve.start_dir.y * curve.planar_mm;
+      block->flag.curve = true;
+    }
+  #endif
+
   TERN_(HAS_EXTRUDERS, steps_dist_mm.e = esteps_float * mm_per_step[E_AXIS_N(extruder)]);
 
   TERN_(LCD_SHOW_E_TOTAL, e_move_accumulator += steps_dist_mm.e);
@@ -2118,11 +2307,11 @@ bool Planner::_populate_block(
       && block->steps.k < MIN_STEPS_PER_SEGMENT
     )
   ) {
-    block->millimeters = TERN0(HAS_EXTRUDERS, ABS(steps_dist_mm.e));
+    millimeters = TERN0(HAS_EXTRUDERS, ABS(steps_dist_mm.e));
   }
   else {
     if (hints.millimeters)
-      block->millimeters = hints.millimeters;
+      millimeters = hints.millimeters;
     else {
       /**
        * Distance for interpretation of feedrate in accordance with LinuxCNC (the successor of NIST
@@ -2160,7 +2349,7 @@ bool Planner::_populate_block(
         }
       #endif
 
-      block->millimeters = SQRT(distance_sqr);
+      millimeters = SQRT(distance_sqr);
     }
 
     /**
@@ -2285,7 +2474,7 @@ bool Planner::_populate_block(
   else
     NOLESS(fr_mm_s, settings.min_travel_feedrate_mm_s);
 
-  const float inverse_millimeters = 1.0f / block->millimeters;  // Inverse millimeters to remove multiple divides
+  const float inverse_millimeters = 1.0f / millimeters;  // Inverse millimeters to remove multiple divides
 
   // Calculate inverse time for this move. No divide by zero due to previous checks.
   // Example: At 120mm/s a 60mm move involving XYZ axes takes 0.5s. So this will give 2.0.
@@ -2296,7 +2485,7 @@ bool Planner::_populate_block(
   const uint8_t moves_queued = nonbusy_movesplanned();
 
   // Slow down when the buffer starts to empty, rather than wait at the corner for a buffer refill
-  #if EITHER(SLOWDOWN, HAS_WIRED_LCD) || defined(XY_FREQUENCY_LIMIT)
+  #if EITHER(SLOWDOWN, HAS_BLOCK_RUNTIME) || defined(XY_FREQUENCY_LIMIT)
     // Segment time in microseconds
     int32_t segment_time_us = LROUND(1000000.0f / inverse_secs);
   #endif
@@ -2305,20 +2494,23 @@ bool Planner::_populate_block(
     #ifndef SLOWDOWN_DIVISOR
       #define SLOWDOWN_DIVISOR 2
     #endif
-    if (WITHIN(moves_queued, 2, (BLOCK_BUFFER_SIZE) / (SLOWDOWN_DIVISOR) - 1)) {
+    // With the time-based buffer, a buffer of long moves isn't draining
+    if (WITHIN(moves_queued, 2, (BLOCK_BUFFER_SIZE) / (SLOWDOWN_DIVISOR) - 1)
+      && TERN1(PLANNER_TIME_BUFFER, block_buffer_runtime_us < (PLANNER_BUFFER_TIME) * 1000UL / (SLOWDOWN_DIVISOR))
+    ) {
       const int32_t time_diff = settings.min_segment_time_us - segment_time_us;
       if (time_diff > 0) {
         // Buffer is draining so add extra time. The amount of time added increases if the buffer is still emptied more.
         const int32_t nst = segment_time_us + LROUND(2 * time_diff / moves_queued);
         inverse_secs = 1000000.0f / nst;
-        #if defined(XY_FREQUENCY_LIMIT) || HAS_WIRED_LCD
+        #if defined(XY_FREQUENCY_LIMIT) || HAS_BLOCK_RUNTIME
           segment_time_us = nst;
         #endif
       }
     }
   #endif
 
-  #if HAS_WIRED_LCD
+  #if HAS_BLOCK_RUNTIME
     // Protect the access to the position.
     const bool was_enabled = stepper.suspend();
 
@@ -2328,7 +2520,7 @@ bool Planner::_populate_block(
     if (was_enabled) stepper.wake_up();
   #endif
 
-  block->nominal_speed = block->millimeters * inverse_secs;           // (mm/sec) Always > 0
+  block->nominal_speed = millimeters * inverse_secs;           // (mm/sec) Always > 0
   block->nominal_rate = CEIL(block->step_event_count * inverse_secs); // (step/sec) Always > 0
 
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
@@ -2349,6 +2541,16 @@ bool Planner::_populate_block(
     if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
   }
 
+  #if ENABLED(FTM_CURVE_BLOCKS)
+    // Somewhere along a curve each of its plane axes may take all of the planar speed
+    if (block->flag.curve) {
+      const ft_curve_t &curve = FTMotion::curves[bindex];
+      const feedRate_t cs = curve.planar_mm * inverse_secs,
+                   max_fr = _MIN(settings.max_feedrate_mm_s[curve.axis_p], settings.max_feedrate_mm_s[curve.axis_q]);
+      if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
+    }
+  #endif
+
   // Limit speed on extruders, if any
   #if HAS_EXTRUDERS
     {
@@ -2475,7 +2677,7 @@ bool Planner::_populate_block(
       if (block->use_advance_lead) {
         block->e_D_ratio = (target_float.e - position_float.e) /
           #if IS_KINEMATIC
-            block->millimeters
+            millimeters
           #else
             SQRT(sq(target_float.x - position_float.x)
                + sq(target_float.y - position_float.y)
@@ -2487,7 +2689,7 @@ bool Planner::_populate_block(
         // This assumes no one will use a retract length of 0mm < retr_length < ~0.2mm and no one will print 100mm wide lines using 3mm filament or 35mm wide lines using 1.75mm filament.
         if (block->e_D_ratio > 3.0f)
           block->use_advance_lead = false;
-        else {
+        else if (!TERN0(SMOOTH_LIN_ADVANCE, FTMotion::active)) { // The averaged advance needs no limit
           const uint32_t max_accel_steps_per_s2 = MAX_E_JERK(extruder) / (extruder_advance_K[active_extruder] * block->e_D_ratio) * steps_per_mm;
           if (TERN0(LA_DEBUG, accel > max_accel_steps_per_s2))
             SERIAL_ECHOLNPGM("Acceleration limited.");
@@ -2513,15 +2715,28 @@ bool Planner::_populate_block(
     }
   }
   block->acceleration_steps_per_s2 = accel;
-  block->acceleration = accel / steps_per_mm;
+  acceleration = accel / steps_per_mm;
+
+  #if ENABLED(FTM_CURVE_BLOCKS)
+    // Keep the centripetal acceleration in the tightest bend of a curve within the block acceleration
+    if (block->flag.curve) {
+      const float max_speed_sqr = _MAX(acceleration * FTMotion::curves[bindex].min_radius, sq(float(MINIMUM_PLANNER_SPEED)));
+      if (sq(block->nominal_speed) > max_speed_sqr) {
+        const float factor = SQRT(max_speed_sqr) / block->nominal_speed;
+        current_speed *= factor;
+        block->nominal_rate *= factor;
+        block->nominal_speed *= factor;
+      }
+    }
+  #endif
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = (uint32_t)(accel * (float(1UL << 24) / (STEPPER_TIMER_RATE)));
   #endif
   #if ENABLED(LIN_ADVANCE)
     if (block->use_advance_lead) {
-      block->advance_speed = (STEPPER_TIMER_RATE) / (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
+      block->advance_speed = (STEPPER_TIMER_RATE) / (extruder_advance_K[active_extruder] * block->e_D_ratio * acceleration * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
       #if ENABLED(LA_DEBUG)
-        if (extruder_advance_K[active_extruder] * block->e_D_ratio * block->acceleration * 2 < block->nominal_speed * block->e_D_ratio)
+        if (extruder_advance_K[active_extruder] * block->e_D_ratio * acceleration * 2 < block->nominal_speed * block->e_D_ratio)
           SERIAL_ECHOLNPGM("More than 2 steps per eISR loop executed.");
         if (block->advance_speed < 200)
           SERIAL_ECHOLNPGM("eISR running at > 10kHz.");
@@ -2612,7 +2827,7 @@ bool Planner::_populate_block(
         xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
         normalize_junction_vector(junction_unit_vec);
 
-        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec);
+        const float junction_acceleration = limit_value_by_axis_maximum(acceleration, junction_unit_vec);
 
         if (TERN0(HINTS_CURVE_RADIUS, hints.curve_radius)) {
           TERN_(HINTS_CURVE_RADIUS, vmax_junction_sqr = junction_acceleration * hints.curve_radius);
@@ -2627,7 +2842,7 @@ bool Planner::_populate_block(
           #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
 
             // For small moves with >135° junction (octagon) find speed for approximate arc
-            if (block->millimeters < 1 && junction_cos_theta < -0.7071067812f) {
+            if (millimeters < 1 && junction_cos_theta < -0.7071067812f) {
 
               #if ENABLED(JD_USE_MATH_ACOS)
 
@@ -2706,7 +2921,7 @@ bool Planner::_populate_block(
 
               #endif
 
-              const float limit_sqr = (block->millimeters * junction_acceleration) / junction_theta;
+              const float limit_sqr = (millimeters * junction_acceleration) / junction_theta;
               NOMORE(vmax_junction_sqr, limit_sqr);
             }
 
@@ -2720,6 +2935,9 @@ bool Planner::_populate_block(
     else // Init entry speed to zero. Assume it starts from rest. Planner will correct this later.
       vmax_junction_sqr = 0;
 
+    // The next block joins a curve at its end
+    TERN_(FTM_CURVE_BLOCKS, if (block->flag.curve) FTMotion::curves[bindex].turn_to_end(unit_vec));
+
     prev_unit_vec = unit_vec;
 
   #endif
@@ -2822,13 +3040,13 @@ bool Planner::_populate_block(
   #endif // Classic Jerk Limiting
 
   // Max entry speed of this block equals the max exit speed of the previous block.
-  block->max_entry_speed_sqr = vmax_junction_sqr;
+  junction.max_entry_speed_sqr[bindex] = vmax_junction_sqr;
 
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
-  const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters);
+  const float v_allowable_sqr = max_allowable_speed_sqr(-acceleration, sq(float(MINIMUM_PLANNER_SPEED)), millimeters);
 
   // Start with the minimum allowed speed
-  block->entry_speed_sqr = sq(float(MINIMUM_PLANNER_SPEED));
+  junction.entry_speed_sqr[bindex] = sq(float(MINIMUM_PLANNER_SPEED));
 
   // Initialize planner efficiency flags
   // Set flag if block will always reach maximum junction speed regardless of entry/exit speeds.
@@ -2842,6 +3060,7 @@ bool Planner::_populate_block(
 
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
+  TERN_(FTM_CURVE_BLOCKS, if (block->flag.curve) FTMotion::curves[bindex].turn_to_end(previous_speed));
   previous_nominal_speed = block->nominal_speed;
 
   position = target;  // Update the position
@@ -2866,6 +3085,9 @@ bool Planner::_populate_block(
  */
 void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_POSITION*/) {
 
+  // The held move comes first
+  TERN_(HAS_HELD_MOVE, release_held_move());
+
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
@@ -2927,6 +3149,9 @@ bool Planner::buffer_segment(const abce_pos_t &abce
   // If we are cleaning, do not accept queuing of movements
   if (cleaning_buffer_counter) return false;
 
+  // The held move comes first
+  TERN_(HAS_HELD_MOVE, release_held_move());
+
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
     if (last_extruder != extruder && settings.axis_steps_per_mm[E_AXIS_N(extruder)] != settings.axis_steps_per_mm[E_AXIS_N(last_extruder)]) {
@@ -3071,13 +3296,220 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
     }
     return false;
   #else
+    TERN_(COALESCE_SEGMENTS, if (hold_move(machine, fr_mm_s, extruder, hints)) return true);
+    TERN_(PATH_BLENDING, if (blend_move(machine, fr_mm_s, extruder, hints)) return true);
     return buffer_segment(machine, fr_mm_s, extruder, hints);
   #endif
 } // buffer_line()
 
+#if ENABLED(COALESCE_SEGMENTS)
+
+  /**
+   * Hold a short move to merge with the ones after it. A move joins the held one if
+   * every point merged away stays within COALESCE_TOLERANCE of the merged move, with
+   * its E in place along it. Return false if the move should go to buffer_segment,
+   * which queues the held move first.
+   */
+  bool Planner::hold_move(const abce_pos_t &abce, const_feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints) {
+    const abce_pos_t &from = held.count ? held.end[held.count - 1] : position_float;
+    float len_sq = 0;
+    LOOP_NUM_AXES(i) len_sq += sq(abce[i] - from[i]);
+
+    // Only plain moves, short and with some motion
+    const bool short_move = !hints.millimeters && !hints.curve_radius
+                         && TERN1(HINTS_SAFE_EXIT_SPEED, !hints.safe_exit_speed_sqr)
+                         && WITHIN(len_sq, 1e-8f, sq(float(COALESCE_MAX_LENGTH)));
+
+    if (held.count) {
+      bool merge = short_move && extruder == held.extruder && fr_mm_s == held.fr_mm_s && held_laser_same() && held.count < COALESCE_MAX_MOVES;
+
+      // Check the points along the move from the held start to the new end
+      const abce_pos_t &s = held.start;
+      const xyze_float_t line = abce - s;
+      float line_sq = 0;
+      LOOP_NUM_AXES(i) line_sq += sq(line[i]);
+      if (line_sq < sq(float(COALESCE_TOLERANCE))) merge = false;
+
+      const float line_mm = SQRT(line_sq);
+      float last_f = 0;
+      for (uint8_t k = 0; merge && k < held.count; k++) {
+        const abce_pos_t &p = held.end[k];
+        float dot = 0;
+        LOOP_NUM_AXES(i) dot += (p[i] - s[i]) * line[i];
+        const float f = dot / line_sq;
+        float off_sq = 0;
+        LOOP_NUM_AXES(i) off_sq += sq(p[i] - s[i] - f * line[i]);
+        merge = f >= last_f && f <= 1 && off_sq <= sq(float(COALESCE_TOLERANCE))
+          // The E at this point would land no farther than the tolerance along the move
+          && TERN1(HAS_EXTRUDERS, ABS(p.e - s.e - f * line.e) * line_mm <= (COALESCE_TOLERANCE) * ABS(line.e));
+        last_f = f;
+      }
+
+      if (merge) {
+        held.end[held.count++] = abce;
+        coalesce_moves++;
+        return true;
+      }
+
+      release_held_move();
+    }
+
+    if (!short_move) return false;
+
+    held.start = position_float;
+    held.end[0] = abce;
+    held.count = 1;
+    held.since = millis();
+    held.fr_mm_s = fr_mm_s;
+    held.extruder = extruder;
+    TERN_(LASER_FEATURE, held.laser.power = laser_inline.power; held.laser.status = laser_inline.status);
+    coalesce_moves++;
+    return true;
+  }
+
+#endif // COALESCE_SEGMENTS
+
+#if ENABLED(PATH_BLENDING)
+
+  /**
+   * Hold a line move to blend into the one after it. The corner between them is
+   * cut by an arc that passes within blend_tolerance of the vertex, queued as a
+   * few chords with the arc radius as a hint, so the junction speed comes from
+   * the arc and not from the turn. Each move gives at most half of its length to
+   * the blends at its two ends. Return false if the move should go to
+   * buffer_segment, which queues the held move first.
+   */
+  bool Planner::blend_move(const abce_pos_t &abce, const_feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints) {
+    if (!blend_tolerance) return false;
+
+    const abce_pos_t &from = held.count ? held.end[0] : position_float;
+    const xyze_float_t b = abce - from;
+    float lb_sq = 0;
+    LOOP_NUM_AXES(i) lb_sq += sq(b[i]);
+
+    // Only plain moves with some motion
+    if (hints.millimeters || hints.curve_radius || TERN0(HINTS_SAFE_EXIT_SPEED, hints.safe_exit_speed_sqr) || lb_sq < 1e-8f)
+      return false;
+
+    const float lb = SQRT(lb_sq);
+
+    if (held.count && extruder == held.extruder && held_laser_same()) {
+      const abce_pos_t s = held.start, p = held.end[0];
+      const xyze_float_t a = p - s;
+      float la_sq = 0, dot = 0;
+      LOOP_NUM_AXES(i) { la_sq += sq(a[i]); dot += a[i] * b[i]; }
+      const float la = SQRT(la_sq),
+                  cos_turn = la > 0 ? dot / (la * lb) : 1;
+
+      // Nearly straight on needs no blend, and a reversal has no room for one
+      if (WITHIN(cos_turn, -0.985f, 0.99999f)) {
+        /**
+         * The arc meets each move at d from the vertex. Its midpoint is at r/c2 - r
+         * from the vertex, so the chords, which fall up to a quarter of that farther
+         * inside, stay within the tolerance.
+         */
+        const float tol = blend_tolerance * 0.8f,
+                    c2 = SQRT((1 + cos_turn) * 0.5f),   // Cosine of half the turn
+                    s2 = SQRT((1 - cos_turn) * 0.5f),   // Sine of half the turn
+                    d = _MIN(tol * s2 / (1 - c2), 0.5f * _MIN(held.length, lb), la),
+                    r = d * c2 / s2,
+                    turn = ACOS(cos_turn);
+
+        abce_pos_t a1 = s, b1 = p;
+        LOOP_LOGICAL_AXES(i) {
+          a1[i] += a[i] * (1 - d / la);
+          b1[i] += b[i] * (d / lb);
+        }
+
+        // The move before the corner, up to the start of the arc
+        const feedRate_t held_fr = held.fr_mm_s;
+        held.count = 0;
+        if (!buffer_held(a1, held_fr)) return false;
+
+        // Chords short enough to fall no more than a quarter of the tolerance inside the arc.
+        // A tight arc may take a single chord.
+        const float step = 2 * ACOS(_MAX(1 - 0.25f * tol / r, -1.0f));
+        const uint8_t n = uint8_t(constrain(CEIL(turn / step), 1.0f, float(BLEND_MAX_SEGMENTS)));
+
+        // The chords are shorter than the corner they cut, so they get a share of its E
+        #if HAS_EXTRUDERS
+          const float e_corner = b1.e - a1.e,
+                      e_blend = e_corner * _MIN(n * r * sin(turn * 0.5f / n) / d, 1.0f);
+        #endif
+
+        // The arc center is on the bisector, at r / c2 from the vertex
+        abce_pos_t c = p;
+        const float to_c = r / c2 * 0.5f / s2;
+        LOOP_NUM_AXES(i) c[i] += (b[i] / lb - a[i] / la) * to_c;
+
+        PlannerHints ph;
+        ph.curve_radius = r;
+        const float sin_turn = sin(turn);
+        const feedRate_t fr = _MIN(held_fr, fr_mm_s);
+        for (uint8_t k = 1; k < n; k++) {
+          const float f = float(k) / n, w1 = sin(turn * (1 - f)) / sin_turn, w2 = sin(turn * f) / sin_turn;
+          abce_pos_t pt = b1;
+          LOOP_NUM_AXES(i) pt[i] = c[i] + w1 * (a1[i] - c[i]) + w2 * (b1[i] - c[i]);
+          TERN_(HAS_EXTRUDERS, pt.e = a1.e + f * e_blend);
+          if (!buffer_segment(pt, fr, extruder, ph)) return false;
+        }
+        abce_pos_t b2 = b1;
+        TERN_(HAS_EXTRUDERS, b2.e = a1.e + e_blend);
+        if (!buffer_segment(b2, fr, extruder, ph)) return false;
+
+        #if HAS_EXTRUDERS
+          // Go on from the E at the end of the corner. As for a cold extrusion, the
+          // E left out is skipped in the planner only, so motion isn't held for a sync.
+          position_float.e = b1.e;
+          position.e = LROUND(b1.e * settings.axis_steps_per_mm[E_AXIS_N(extruder)]);
+        #endif
+      }
+    }
+
+    // Hold the new move for the next corner
+    release_held_move();
+    held.start = position_float;
+    held.end[0] = abce;
+    held.count = 1;
+    held.since = millis();
+    held.length = lb;
+    held.fr_mm_s = fr_mm_s;
+    held.extruder = extruder;
+    TERN_(LASER_FEATURE, held.laser.power = laser_inline.power; held.laser.status = laser_inline.status);
+    return true;
+  }
+
+#endif // PATH_BLENDING
+
+#if HAS_HELD_MOVE
+
+  // Queue a held move with the laser state it came with
+  bool Planner::buffer_held(const abce_pos_t &abce, const_feedRate_t fr_mm_s, const PlannerHints &hints) {
+    #if ENABLED(LASER_FEATURE)
+      const uint8_t power = laser_inline.power;
+      const power_status_t status = laser_inline.status;
+      laser_inline.power = held.laser.power;
+      laser_inline.status = held.laser.status;
+    #endif
+    const bool ok = buffer_segment(abce, fr_mm_s, held.extruder, hints);
+    TERN_(LASER_FEATURE, laser_inline.power = power; laser_inline.status = status);
+    return ok;
+  }
+
+  bool Planner::release_held_move() {
+    if (!held.count) return true;
+    const abce_pos_t end = held.end[held.count - 1];
+    held.count = 0;
+    TERN_(COALESCE_SEGMENTS, coalesce_blocks++);
+    return buffer_held(end, held.fr_mm_s);
+  }
+
+#endif // HAS_HELD_MOVE
+
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
+    TERN_(HAS_HELD_MOVE, release_held_move());
     if (!last_page_step_rate) {
       kill(GET_TEXT_F(MSG_BAD_PAGE_SPEED));
       return;
@@ -3141,6 +3573,7 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
  * The provided ABCE position is in machine units.
  */
 void Planner::set_machine_position_mm(const abce_pos_t &abce) {
+  TERN_(HAS_HELD_MOVE, release_held_move());
   TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
   TERN_(HAS_POSITION_FLOAT, position_float = abce);
   position.set(
@@ -3190,6 +3623,7 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
    * Setters for planner position (also setting stepper position).
    */
   void Planner::set_e_position_mm(const_float_t e) {
+    TERN_(HAS_HELD_MOVE, release_held_move());
     const uint8_t axis_index = E_AXIS_N(active_extruder);
     TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
 
@@ -3310,7 +3744,7 @@ void Planner::set_max_feedrate(const AxisEnum axis, float inMaxFeedrateMMS) {
 
 #endif
 
-#if HAS_WIRED_LCD
+#if HAS_BLOCK_RUNTIME
 
   uint16_t Planner::block_buffer_runtime() {
     #ifdef __AVR__
@@ -76,6 +76,11 @@
   #include "../feature/closedloop.h"
 #endif
 
+// Track the time of the queued moves, for the LCD and the time-based buffer
+#if EITHER(HAS_WIRED_LCD, PLANNER_TIME_BUFFER)
+  #define HAS_BLOCK_RUNTIME 1
+#endif
+
 // Feedrate for manual moves
 #ifdef MANUAL_FEEDRATE
   constexpr xyze_feedrate_t _mf = MANUAL_FEEDRATE,
@@ -115,6 +120,9 @@ enum BlockFlagBit {
 
   // Sync laser power from a queued block
   OPTARG(LASER_POWER_SYNC, BLOCK_BIT_LASER_PWR)
+
+  // Fixed-Time Motion traces a curve, kept in FTMotion::curves
+  OPTARG(FTM_CURVE_BLOCKS, BLOCK_BIT_CURVE)
 };
 
 /**
@@ -144,6 +152,10 @@ typedef struct {
       #if ENABLED(LASER_POWER_SYNC)
         bool sync_laser_pwr:1;
       #endif
+
+      #if ENABLED(FTM_CURVE_BLOCKS)
+        bool curve:1;
+      #endif
     };
   };
 
@@ -191,18 +203,36 @@ typedef struct PlannerBlock {
 
   volatile block_flags_t flag;              // Block flags
 
+  // Byte-sized fields go together here, in the padding after the flags, to keep the block small
+
+  axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+
+  #if HAS_MULTI_EXTRUDER
+    uint8_t extruder;                       // The extruder to move (if E move)
+  #else
+    static constexpr uint8_t extruder = 0;
+  #endif
+
+  #if ENABLED(LIN_ADVANCE)
+    bool use_advance_lead;
+  #endif
+
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
+  #endif
+
   volatile bool is_fan_sync() { return TERN0(LASER_SYNCHRONOUS_M106_M107, flag.sync_fans); }
   volatile bool is_pwr_sync() { return TERN0(LASER_POWER_SYNC, flag.sync_laser_pwr); }
   volatile bool is_sync() { return flag.sync_position || is_fan_sync() || is_pwr_sync(); }
   volatile bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
   volatile bool is_move() { return !(is_sync() || is_page()); }
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed,                      // The nominal speed for this block in (mm/sec)
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
+  // Fields used by the motion planner to manage acceleration. See also block_junction_t.
+  float nominal_speed;                      // The nominal speed for this block in (mm/sec)
 
   union {
     abce_ulong_t steps;                     // Step count along each axis
@@ -210,12 +240,6 @@ typedef struct PlannerBlock {
   };
   uint32_t step_event_count;                // The number of step events required to complete this block
 
-  #if HAS_MULTI_EXTRUDER
-    uint8_t extruder;                       // The extruder to move (if E move)
-  #else
-    static constexpr uint8_t extruder = 0;
-  #endif
-
   #if ENABLED(MIXING_EXTRUDER)
     mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
   #endif
@@ -234,11 +258,8 @@ typedef struct PlannerBlock {
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
-  axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
-    bool use_advance_lead;
     uint16_t advance_speed,                 // STEP timer value for extruder speed offset ISR
              max_adv_steps,                 // max. advance steps to get cruising speed pressure (not always nominal_speed!)
              final_adv_steps;               // advance steps due to exit speed
@@ -258,15 +279,7 @@ typedef struct PlannerBlock {
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
 
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
-  #endif
-
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
-  #endif
-
-  #if HAS_WIRED_LCD
+  #if HAS_BLOCK_RUNTIME
     uint32_t segment_time_us;
   #endif
 
@@ -283,7 +296,21 @@ typedef struct PlannerBlock {
 
 } block_t;
 
-#if ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL, POWER_LOSS_RECOVERY)
+/**
+ * Lookahead data for the blocks in the planner buffer, indexed like block_buffer.
+ *
+ * The reverse and forward passes read and write only these values for every
+ * block they visit, so they are kept in a few dense arrays instead of being
+ * spread over the large block_t records.
+ */
+typedef struct {
+  float entry_speed_sqr[BLOCK_BUFFER_SIZE],       // Entry speed at previous-current junction in (mm/sec)^2
+        max_entry_speed_sqr[BLOCK_BUFFER_SIZE],   // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters[BLOCK_BUFFER_SIZE],           // The total travel of the block in mm
+        acceleration[BLOCK_BUFFER_SIZE];          // acceleration mm/sec^2
+} block_junction_t;
+
+#if ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL, POWER_LOSS_RECOVERY, COALESCE_SEGMENTS, PATH_BLENDING)
   #define HAS_POSITION_FLOAT 1
 #endif
 
@@ -350,13 +377,27 @@ typedef struct {
   typedef IF<(BLOCK_BUFFER_SIZE > 64), uint16_t, uint8_t>::type last_move_t;
 #endif
 
-#if ENABLED(ARC_SUPPORT)
+#if EITHER(ARC_SUPPORT, PATH_BLENDING)
   #define HINTS_CURVE_RADIUS
+#endif
+#if ENABLED(ARC_SUPPORT)
   #define HINTS_SAFE_EXIT_SPEED
 #endif
 
+#if EITHER(COALESCE_SEGMENTS, PATH_BLENDING)
+  #define HAS_HELD_MOVE 1
+  #define HELD_MOVE_MS TERN(COALESCE_SEGMENTS, COALESCE_HOLD_MS, BLEND_HOLD_MS)
+#endif
+
+#if ENABLED(FTM_CURVE_BLOCKS)
+  struct ft_curve_t;
+#endif
+
 struct PlannerHints {
   float millimeters = 0.0;            // Move Length, if known, else 0.
+  #if ENABLED(FTM_CURVE_BLOCKS)
+    const ft_curve_t *curve = nullptr; // A curve to trace in a single block. Needs millimeters.
+  #endif
   #if ENABLED(SCARA_FEEDRATE_SCALING)
     float inv_duration = 0.0;         // Reciprocal of the move duration, if known
   #endif
@@ -391,6 +432,7 @@ class Planner {
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
      */
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
+    static block_junction_t junction;               // Lookahead data of the blocks in block_buffer
     static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
                             block_buffer_nonbusy,   // Index of the first non busy block
                             block_buffer_planned,   // Index of the optimally planned block
@@ -525,7 +567,7 @@ class Planner {
       static last_move_t g_uc_extruder_last_move[E_STEPPERS];
     #endif
 
-    #if HAS_WIRED_LCD
+    #if HAS_BLOCK_RUNTIME
       volatile static uint32_t block_buffer_runtime_us; // Theoretical block buffer runtime in µs
     #endif
 
@@ -737,6 +779,12 @@ class Planner {
       }
     #endif // HAS_POSITION_MODIFIERS
 
+    // Index of a block in block_buffer
+    FORCE_INLINE static uint8_t block_index(const block_t * const block) { return uint8_t(block - block_buffer); }
+
+    // Length of a block in block_buffer
+    FORCE_INLINE static float block_millimeters(const block_t * const block) { return junction.millimeters[block_index(block)]; }
+
     // Number of moves currently in the planner including the busy block, if any
     FORCE_INLINE static uint8_t movesplanned() { return BLOCK_MOD(block_buffer_head - block_buffer_tail); }
 
@@ -750,7 +798,13 @@ class Planner {
     FORCE_INLINE static bool is_full() { return block_buffer_tail == next_block_index(block_buffer_head); }
 
     // Get count of movement slots free
-    FORCE_INLINE static uint8_t moves_free() { return BLOCK_BUFFER_SIZE - 1 - movesplanned(); }
+    FORCE_INLINE static uint8_t moves_free() {
+      #if ENABLED(PLANNER_TIME_BUFFER)
+        // Hold new moves once enough motion is queued to ride out a gap in the input
+        if (nonbusy_movesplanned() >= PLANNER_BUFFER_MIN_MOVES && block_buffer_runtime_us >= (PLANNER_BUFFER_TIME) * 1000UL) return 0;
+      #endif
+      return BLOCK_BUFFER_SIZE - 1 - movesplanned();
+    }
 
     /**
      * Planner::get_next_free_block
@@ -860,6 +914,32 @@ class Planner {
       , const PlannerHints &hints=PlannerHints()
     );
 
+    #if HAS_HELD_MOVE
+      // A move is waiting for the next ones, to merge with them or blend into them
+      static bool has_held_move() { return held.count; }
+
+      // Queue the waiting move now
+      static bool release_held_move();
+
+      // The waiting move should go now: the planner is about to run dry, or the next move is late
+      static bool held_move_due() {
+        return nonbusy_movesplanned() < 2 || ELAPSED(millis(), held.since + (HELD_MOVE_MS));
+      }
+    #endif
+
+    #if ENABLED(COALESCE_SEGMENTS)
+      static uint32_t coalesce_moves, coalesce_blocks;  // Short moves taken, and the blocks they made
+    #endif
+
+    #if ENABLED(PATH_BLENDING)
+      static float blend_tolerance;                     // (mm) Farthest a blended corner passes from its vertex. 0 for the exact path.
+
+      static void set_blend_tolerance(const_float_t mm) {
+        release_held_move();
+        blend_tolerance = _MAX(mm, 0.0f);
+      }
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -928,12 +1008,9 @@ class Planner {
     // Triggered position of an axis in mm (not core-savvy)
     static float triggered_position_mm(const AxisEnum axis);
 
-    // Blocks are queued, or we're running out moves, or the closed loop controller is waiting
-    static bool busy() {
-      return (has_blocks_queued() || cleaning_buffer_counter
-          || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
-      );
-    }
+    // Blocks are queued, or we're running out moves, or the closed loop controller is waiting,
+    // or input shaping echoes are still to be played
+    static bool busy();
 
     // Block until all buffered steps are executed / cleaned
     static void synchronize();
@@ -960,6 +1037,15 @@ class Planner {
      */
     static block_t* get_current_block();
 
+    #if ENABLED(FT_MOTION)
+      /**
+       * Get the block after the busy ones for processing
+       * and mark it as busy too. Fixed-Time Motion reads blocks
+       * ahead of the stepper, which releases them when done.
+       */
+      static block_t* get_next_block();
+    #endif
+
     /**
      * "Release" the current block so its slot can be reused.
      * Called when the current block is no longer needed.
@@ -969,7 +1055,7 @@ class Planner {
         block_buffer_tail = next_block_index(block_buffer_tail);
     }
 
-    #if HAS_WIRED_LCD
+    #if HAS_BLOCK_RUNTIME
       static uint16_t block_buffer_runtime();
       static void clear_block_buffer_runtime();
     #endif
@@ -1013,9 +1099,18 @@ class Planner {
      * 'distance'.
      */
     static float max_allowable_speed_sqr(const_float_t accel, const_float_t target_velocity_sqr, const_float_t distance) {
-      return target_velocity_sqr - 2 * accel * distance;
+      #ifdef S_CURVE_MAX_JERK
+        return s_curve_speed_sqr(-accel, target_velocity_sqr, distance, S_CURVE_MAX_JERK);
+      #else
+        return target_velocity_sqr - 2 * accel * distance;
+      #endif
     }
 
+    #ifdef S_CURVE_MAX_JERK
+      static float s_curve_time(const_float_t dv, const_float_t accel, const_float_t jerk);
+      static float s_curve_speed_sqr(const_float_t accel, const_float_t target_velocity_sqr, const_float_t distance, const_float_t jerk);
+    #endif
+
     #if ENABLED(S_CURVE_ACCELERATION)
       /**
        * Calculate the speed reached given initial speed, acceleration and distance
@@ -1027,16 +1122,49 @@ class Planner {
 
     static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
 
-    static void reverse_pass_kernel(block_t * const current, const block_t * const next OPTARG(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
-    static void forward_pass_kernel(const block_t * const previous, block_t * const current, uint8_t block_index);
+    static bool reverse_pass_kernel(const uint8_t index, const_float_t next_entry_speed_sqr, const bool next_changed);
+    static void forward_pass_kernel(const uint8_t previous, const uint8_t current);
 
-    static void reverse_pass(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
-    static void forward_pass();
+    static uint8_t reverse_pass(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void forward_pass(const uint8_t start_index);
 
-    static void recalculate_trapezoids(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void recalculate_trapezoids(const uint8_t start_index OPTARG(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
 
     static void recalculate(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
 
+    #if HAS_HELD_MOVE
+      // Short moves merged into one, or the move before a corner to blend
+      static struct held_move_t {
+        uint8_t count;                            // Moves merged, 0 if none is held
+        millis_t since;                           // When the first move was held
+        abce_pos_t start,                         // Where the queued path ends
+                   end[TERN(COALESCE_SEGMENTS, COALESCE_MAX_MOVES, 1)]; // The end of each move merged
+        feedRate_t fr_mm_s;
+        uint8_t extruder;
+        #if ENABLED(PATH_BLENDING)
+          float length;                           // Length of the whole move, before a blend took its start
+        #endif
+        #if ENABLED(LASER_FEATURE)
+          laser_state_t laser;                    // The inline laser state the move came with
+        #endif
+      } held;
+
+      static bool buffer_held(const abce_pos_t &abce, const_feedRate_t fr_mm_s, const PlannerHints &hints=PlannerHints());
+
+      // True if the inline laser state is still the one of the held move
+      static bool held_laser_same() {
+        return TERN1(LASER_FEATURE, laser_inline.power == held.laser.power && laser_inline.status.isPowered == held.laser.status.isPowered);
+      }
+    #endif
+
+    #if ENABLED(COALESCE_SEGMENTS)
+      static bool hold_move(const abce_pos_t &abce, const_feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints);
+    #endif
+
+    #if ENABLED(PATH_BLENDING)
+      static bool blend_move(const abce_pos_t &abce, const_feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints);
+    #endif
+
     #if HAS_JUNCTION_DEVIATION
 
       FORCE_INLINE static void normalize_junction_vector(xyze_float_t &vector) {
@@ -37,6 +37,10 @@
 #include "../MarlinCore.h"
 #include "../gcode/queue.h"
 
+#if ENABLED(FTM_CURVE_BLOCKS)
+  #include "ft_motion.h"
+#endif
+
 // See the meaning in the documentation of cubic_b_spline().
 #define MIN_STEP 0.002f
 #define MAX_STEP 0.1f
@@ -115,6 +119,41 @@ void cubic_b_spline(
   // Absolute first and second control points are recovered.
   const xy_pos_t first = position + offsets[0], second = target + offsets[1];
 
+  #if ENABLED(FTM_CURVE_BLOCKS)
+    /**
+     * Fixed-Time Motion traces the curve from a few planner blocks, cut where
+     * the bend changes so a tight spot doesn't slow down the rest. The other
+     * axes move in proportion to the length done.
+     */
+    if (ftMotion.curves_ok()) {
+      const xy_pos_t start = position, end = target;
+      ft_curve_t whole;
+      whole.set_bezier(first - start, second - start, end - start);
+      if (whole.within_limits(position)) {
+        uint8_t cut[FTM_CURVE_SAMPLES + 1];
+        const uint8_t parts = whole.bezier_cuts(sq(scaled_fr_mm_s) / planner.settings.acceleration, cut);
+        xyze_pos_t from = position;
+        LOOP_L_N(n, parts) {
+          ft_curve_t curve;
+          curve.set_bezier_part(whole, cut[n], cut[n + 1]);
+
+          xyze_pos_t pos = target;
+          if (n < parts - 1) {
+            pos = position + (target - position) * (whole.length_to(cut[n + 1]) / whole.planar_mm);
+            pos.set(start + whole.at(float(cut[n + 1]) / (FTM_CURVE_SAMPLES)));
+          }
+          apply_motion_limits(pos);
+
+          PlannerHints hints(TERN(HAS_Z_AXIS, HYPOT(curve.planar_mm, pos.z - from.z), curve.planar_mm));
+          hints.curve = &curve;
+          if (!planner.buffer_line(pos, scaled_fr_mm_s, active_extruder, hints)) break;
+          from = pos;
+        }
+        return;
+      }
+    }
+  #endif
+
   xyze_pos_t bez_target;
   bez_target.set(position.x, position.y);
   float step = MAX_STEP;
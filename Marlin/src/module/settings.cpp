@@ -89,6 +89,10 @@
   #include "servo.h"
 #endif
 
+#if ENABLED(FT_MOTION)
+  #include "ft_motion.h"
+#endif
+
 #if HAS_SERVOS && HAS_SERVO_ANGLES
   #define EEPROM_NUM_SERVOS NUM_SERVOS
 #else
@@ -191,6 +195,10 @@ typedef struct {     bool NUM_AXIS_LIST(X:1, Y:1, Z:1, I:1, J:1, K:1), X2:1, Y2:
 // Limit an index to an array size
 #define ALIM(I,ARR) _MIN(I, (signed)COUNT(ARR) - 1)
 
+// One set of bed PID values per bed zone
+#define BED_PID_COUNT TERN(HAS_MULTI_BEDS, BED_COUNT, 1)
+#define BED_PID(B) TERN(HAS_MULTI_BEDS, thermalManager.temp_bed[B], thermalManager.temp_bed).pid
+
 // Defaults for reset / fill in on load
 static const uint32_t   _DMA[] PROGMEM = DEFAULT_MAX_ACCELERATION;
 static const float     _DASU[] PROGMEM = DEFAULT_AXIS_STEPS_PER_UNIT;
@@ -370,7 +378,22 @@ typedef struct SettingsDataStruct {
   //
   // PIDTEMPBED
   //
-  PID_t bedPID;                                         // M304 PID / M303 E-1 U
+  PID_t bedPID[BED_PID_COUNT];                          // M304 Bn PID / M303 E-1 Bn U
+
+  //
+  // BED_ZONE_COUPLING
+  //
+  #if ENABLED(BED_ZONE_COUPLING)
+    float bed_coupling[BED_COUNT][BED_COUNT];           // M307 Bn Cn S / M303 E-1 Bn U
+    float bed_zone_gain[BED_COUNT];                     // M307 Bn P / M303 E-1 Bn U
+  #endif
+
+  //
+  // ADS1115_BED_READING
+  //
+  #if ADS1115_BED_READING
+    Temperature::ads1115_settings_t ads1115_settings;   // M308 R S F
+  #endif
 
   //
   // PIDTEMPCHAMBER
@@ -444,6 +467,30 @@ typedef struct SettingsDataStruct {
   //
   float planner_extruder_advance_K[_MAX(EXTRUDERS, 1)]; // M900 K  planner.extruder_advance_K
 
+  //
+  // Input Shaping
+  //
+  #if ENABLED(INPUT_SHAPING_X)
+    float shaping_x_frequency,                          // M593 X F
+          shaping_x_zeta;                               // M593 X D
+    uint8_t shaping_x_type;                             // M593 X T
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    float shaping_y_frequency,                          // M593 Y F
+          shaping_y_zeta;                               // M593 Y D
+    uint8_t shaping_y_type;                             // M593 Y T
+  #endif
+
+  //
+  // Fixed-Time Motion
+  //
+  #if ENABLED(FT_MOTION)
+    bool ft_motion_active;                              // M493 S
+    #if ENABLED(SMOOTH_LIN_ADVANCE)
+      float ft_advance_time;                            // M900 U
+    #endif
+  #endif
+
   //
   // HAS_MOTOR_CURRENT_PWM
   //
@@ -1081,18 +1128,41 @@ void MarlinSettings::postprocess() {
     {
       _FIELD_TEST(bedPID);
 
-      const PID_t bed_pid = {
-        #if DISABLED(PIDTEMPBED)
-          NAN, NAN, NAN
-        #else
-          // Store the unscaled PID values
-          thermalManager.temp_bed.pid.Kp,
-          unscalePID_i(thermalManager.temp_bed.pid.Ki),
-          unscalePID_d(thermalManager.temp_bed.pid.Kd)
-        #endif
-      };
-      EEPROM_WRITE(bed_pid);
+      for (uint8_t b = 0; b < BED_PID_COUNT; ++b) {
+        const PID_t bed_pid = {
+          #if DISABLED(PIDTEMPBED)
+            NAN, NAN, NAN
+          #else
+            // Store the unscaled PID values
+            BED_PID(b).Kp,
+            unscalePID_i(BED_PID(b).Ki),
+            unscalePID_d(BED_PID(b).Kd)
+          #endif
+        };
+        EEPROM_WRITE(bed_pid);
+      }
+    }
+
+    //
+    // Bed zone thermal coupling
+    //
+    #if ENABLED(BED_ZONE_COUPLING)
+    {
+      _FIELD_TEST(bed_coupling);
+      EEPROM_WRITE(thermalManager.bed_coupling);
+      EEPROM_WRITE(thermalManager.bed_zone_gain);
     }
+    #endif
+
+    //
+    // Bed ADC acquisition
+    //
+    #if ADS1115_BED_READING
+    {
+      _FIELD_TEST(ads1115_settings);
+      EEPROM_WRITE(thermalManager.ads1115_settings);
+    }
+    #endif
 
     //
     // PIDTEMPCHAMBER
@@ -1405,6 +1475,39 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    //
+    // Input Shaping
+    //
+    #if ENABLED(INPUT_SHAPING_X)
+    {
+      _FIELD_TEST(shaping_x_frequency);
+      EEPROM_WRITE(stepper.get_shaping_frequency(X_AXIS));
+      EEPROM_WRITE(stepper.get_shaping_damping_ratio(X_AXIS));
+      EEPROM_WRITE(stepper.get_shaping_type(X_AXIS));
+    }
+    #endif
+    #if ENABLED(INPUT_SHAPING_Y)
+    {
+      _FIELD_TEST(shaping_y_frequency);
+      EEPROM_WRITE(stepper.get_shaping_frequency(Y_AXIS));
+      EEPROM_WRITE(stepper.get_shaping_damping_ratio(Y_AXIS));
+      EEPROM_WRITE(stepper.get_shaping_type(Y_AXIS));
+    }
+    #endif
+
+    //
+    // Fixed-Time Motion
+    //
+    #if ENABLED(FT_MOTION)
+    {
+      _FIELD_TEST(ft_motion_active);
+      EEPROM_WRITE(ftMotion.active);
+      #if ENABLED(SMOOTH_LIN_ADVANCE)
+        EEPROM_WRITE(ftMotion.get_advance_time());
+      #endif
+    }
+    #endif
+
     //
     // Motor Current PWM
     //
@@ -2017,17 +2120,67 @@ void MarlinSettings::postprocess() {
       // Heated Bed PID
       //
       {
-        PID_t pid;
-        EEPROM_READ(pid);
-        #if ENABLED(PIDTEMPBED)
-          if (!validating && !isnan(pid.Kp)) {
-            // Scale PID values since EEPROM values are unscaled
-            thermalManager.temp_bed.pid.Kp = pid.Kp;
-            thermalManager.temp_bed.pid.Ki = scalePID_i(pid.Ki);
-            thermalManager.temp_bed.pid.Kd = scalePID_d(pid.Kd);
+        for (uint8_t b = 0; b < BED_PID_COUNT; ++b) {
+          PID_t pid;
+          EEPROM_READ(pid);
+          #if ENABLED(PIDTEMPBED)
+            if (!validating && !isnan(pid.Kp)) {
+              // Scale PID values since EEPROM values are unscaled
+              BED_PID(b).Kp = pid.Kp;
+              BED_PID(b).Ki = scalePID_i(pid.Ki);
+              BED_PID(b).Kd = scalePID_d(pid.Kd);
+            }
+          #endif
+        }
+      }
+
+      //
+      // Bed zone thermal coupling
+      //
+      #if ENABLED(BED_ZONE_COUPLING)
+      {
+        float bed_coupling[BED_COUNT][BED_COUNT], bed_zone_gain[BED_COUNT];
+        _FIELD_TEST(bed_coupling);
+        EEPROM_READ(bed_coupling);
+        EEPROM_READ(bed_zone_gain);
+        if (!validating) {
+          // Use the defaults if a gain would stall the decoupler or a coupling is unset
+          bool bed_coupling_ok = true;
+          LOOP_L_N(i, BED_COUNT) {
+            if (!isfinite(bed_zone_gain[i]) || bed_zone_gain[i] < 0.1f) bed_coupling_ok = false;
+            LOOP_L_N(j, BED_COUNT) if (isnan(bed_coupling[i][j])) bed_coupling_ok = false;
           }
-        #endif
+          if (bed_coupling_ok) {
+            COPY(thermalManager.bed_coupling, bed_coupling);
+            COPY(thermalManager.bed_zone_gain, bed_zone_gain);
+            thermalManager.update_bed_decoupling();
+          }
+          else
+            thermalManager.reset_bed_coupling();
+        }
       }
+      #endif
+
+      //
+      // Bed ADC acquisition
+      //
+      #if ADS1115_BED_READING
+      {
+        Temperature::ads1115_settings_t ads1115_settings;
+        _FIELD_TEST(ads1115_settings);
+        EEPROM_READ(ads1115_settings);
+        if (!validating) {
+          if (ads1115_settings.data_rate <= 7
+            && WITHIN(ads1115_settings.samples, 1, ADS1115_SAMPLES_MAX) && ads1115_settings.iir_shift <= 6
+          ) {
+            thermalManager.ads1115_settings = ads1115_settings;
+            thermalManager.ads1115_reset_filters();
+          }
+          else
+            thermalManager.reset_ads1115_settings();  // Not left zeroed
+        }
+      }
+      #endif
 
       //
       // Heated Chamber PID
@@ -2340,6 +2493,47 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // Input Shaping
+      //
+      #define SHAPING_LOAD(A, AXIS) do{ \
+        float freq, zeta; \
+        uint8_t type; \
+        _FIELD_TEST(shaping_##A##_frequency); \
+        EEPROM_READ(freq); \
+        EEPROM_READ(zeta); \
+        EEPROM_READ(type); \
+        if (!validating && (freq == 0 || freq >= (SHAPING_MIN_FREQ)) && WITHIN(zeta, 0, 0.99f) && type <= SHAPER_EI) { \
+          stepper.set_shaping_damping_ratio(AXIS, zeta); \
+          stepper.set_shaping_type(AXIS, ShaperType(type)); \
+          stepper.set_shaping_frequency(AXIS, freq); \
+        } \
+      }while(0)
+
+      #if ENABLED(INPUT_SHAPING_X)
+        SHAPING_LOAD(x, X_AXIS);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        SHAPING_LOAD(y, Y_AXIS);
+      #endif
+
+      //
+      // Fixed-Time Motion
+      //
+      #if ENABLED(FT_MOTION)
+      {
+        bool ft_active;
+        _FIELD_TEST(ft_motion_active);
+        EEPROM_READ(ft_active);
+        if (!validating) ftMotion.set_active(ft_active);
+        #if ENABLED(SMOOTH_LIN_ADVANCE)
+          float advance_time;
+          EEPROM_READ(advance_time);
+          if (!validating && WITHIN(advance_time, 0, FTM_ADVANCE_MAX_TIME)) ftMotion.set_advance_time(advance_time);
+        #endif
+      }
+      #endif
+
       //
       // Motor Current PWM
       //
@@ -3115,9 +3309,51 @@ void MarlinSettings::reset() {
   //
 
   #if ENABLED(PIDTEMPBED)
-    thermalManager.temp_bed.pid.Kp = DEFAULT_bedKp;
-    thermalManager.temp_bed.pid.Ki = scalePID_i(DEFAULT_bedKi);
-    thermalManager.temp_bed.pid.Kd = scalePID_d(DEFAULT_bedKd);
+    #if HAS_MULTI_BEDS
+      constexpr float defBedKp[] =
+        #ifdef DEFAULT_bedKp_LIST
+          DEFAULT_bedKp_LIST
+        #else
+          { DEFAULT_bedKp }
+        #endif
+      , defBedKi[] =
+        #ifdef DEFAULT_bedKi_LIST
+          DEFAULT_bedKi_LIST
+        #else
+          { DEFAULT_bedKi }
+        #endif
+      , defBedKd[] =
+        #ifdef DEFAULT_bedKd_LIST
+          DEFAULT_bedKd_LIST
+        #else
+          { DEFAULT_bedKd }
+        #endif
+      ;
+      static_assert(WITHIN(COUNT(defBedKp), 1, BED_COUNT), "DEFAULT_bedKp_LIST must have between 1 and BED_COUNT items.");
+      static_assert(WITHIN(COUNT(defBedKi), 1, BED_COUNT), "DEFAULT_bedKi_LIST must have between 1 and BED_COUNT items.");
+      static_assert(WITHIN(COUNT(defBedKd), 1, BED_COUNT), "DEFAULT_bedKd_LIST must have between 1 and BED_COUNT items.");
+      for (uint8_t b = 0; b < BED_COUNT; ++b) {
+        thermalManager.temp_bed[b].pid.Kp = defBedKp[ALIM(b, defBedKp)];
+        thermalManager.temp_bed[b].pid.Ki = scalePID_i(defBedKi[ALIM(b, defBedKi)]);
+        thermalManager.temp_bed[b].pid.Kd = scalePID_d(defBedKd[ALIM(b, defBedKd)]);
+      }
+    #else
+      thermalManager.temp_bed.pid.Kp = DEFAULT_bedKp;
+      thermalManager.temp_bed.pid.Ki = scalePID_i(DEFAULT_bedKi);
+      thermalManager.temp_bed.pid.Kd = scalePID_d(DEFAULT_bedKd);
+    #endif
+  #endif
+
+  //
+  // Bed zone thermal coupling
+  //
+  TERN_(BED_ZONE_COUPLING, thermalManager.reset_bed_coupling());
+
+  //
+  // Bed ADC acquisition
+  //
+  #if ADS1115_BED_READING
+    thermalManager.reset_ads1115_settings();
   #endif
 
   //
@@ -3203,6 +3439,26 @@ void MarlinSettings::reset() {
     }
   #endif
 
+  //
+  // Input Shaping
+  //
+  #if ENABLED(INPUT_SHAPING_X)
+    stepper.set_shaping_damping_ratio(X_AXIS, SHAPING_ZETA_X);
+    stepper.set_shaping_type(X_AXIS, SHAPING_TYPE_X);
+    stepper.set_shaping_frequency(X_AXIS, SHAPING_FREQ_X);
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    stepper.set_shaping_damping_ratio(Y_AXIS, SHAPING_ZETA_Y);
+    stepper.set_shaping_type(Y_AXIS, SHAPING_TYPE_Y);
+    stepper.set_shaping_frequency(Y_AXIS, SHAPING_FREQ_Y);
+  #endif
+
+  //
+  // Fixed-Time Motion
+  //
+  TERN_(FT_MOTION, ftMotion.set_active(FTM_DEFAULT_ACTIVE));
+  TERN_(SMOOTH_LIN_ADVANCE, ftMotion.set_advance_time(ADVANCE_SMOOTH_TIME));
+
   //
   // Motor Current PWM
   //
@@ -3484,6 +3740,10 @@ void MarlinSettings::reset() {
     //
     TERN_(PIDTEMP,        gcode.M301_report(forReplay));
     TERN_(PIDTEMPBED,     gcode.M304_report(forReplay));
+    TERN_(BED_ZONE_COUPLING, gcode.M307_report(forReplay));
+    #if ADS1115_BED_READING
+      gcode.M308_report(forReplay);
+    #endif
     TERN_(PIDTEMPCHAMBER, gcode.M309_report(forReplay));
 
     #if HAS_USER_THERMISTORS
@@ -3562,6 +3822,16 @@ void MarlinSettings::reset() {
     //
     TERN_(LIN_ADVANCE, gcode.M900_report(forReplay));
 
+    //
+    // Input Shaping
+    //
+    TERN_(HAS_SHAPING, gcode.M593_report(forReplay));
+
+    //
+    // Fixed-Time Motion
+    //
+    TERN_(FT_MOTION, gcode.M493_report(forReplay));
+
     //
     // Motor Current (SPI or PWM)
     //
@@ -139,6 +139,13 @@ Stepper stepper; // Singleton
   #include "../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(FT_MOTION)
+  #include "ft_motion.h"
+  #if ENABLED(FTM_STEP_DMA)
+    #include "../HAL/shared/step_dma.h"
+  #endif
+#endif
+
 // public:
 
 #if EITHER(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -240,6 +247,17 @@ uint32_t Stepper::advance_divisor = 0,
   uint32_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if HAS_SHAPING
+  shaping_params_t Stepper::shaping[2];
+  uint32_t Stepper::nextShapingISR = ShapingQueue::NEVER;
+
+  uint32_t ShapingQueue::now; // = 0
+  uint8_t ShapingQueue::active; // = 0
+  uint32_t ShapingQueue::times[SHAPING_BUFFER_SIZE];
+  uint8_t ShapingQueue::events[SHAPING_BUFFER_SIZE];
+  uint16_t ShapingQueue::tail, ShapingQueue::head[SHAPING_CHANNELS];
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
 #endif
@@ -560,13 +578,19 @@ void Stepper::set_directions() {
 
   DIR_WAIT_BEFORE();
 
+  // The DIR output of a shaped axis follows the echoes, so the shaping phase sets it
+  // (Fixed-Time Motion doesn't shape, so it always sets them here.)
+  #define _DIR_SHAPED(A) TERN0(INPUT_SHAPING_##A, shaping[_AXIS(A)].enabled && !TERN0(FT_MOTION, FTMotion::active))
+
   #define SET_STEP_DIR(A)                       \
     if (motor_direction(_AXIS(A))) {            \
-      A##_APPLY_DIR(INVERT_##A##_DIR, false);   \
+      if (!_DIR_SHAPED(A))                      \
+        A##_APPLY_DIR(INVERT_##A##_DIR, false); \
       count_direction[_AXIS(A)] = -1;           \
     }                                           \
     else {                                      \
-      A##_APPLY_DIR(!INVERT_##A##_DIR, false);  \
+      if (!_DIR_SHAPED(A))                      \
+        A##_APPLY_DIR(!INVERT_##A##_DIR, false);\
       count_direction[_AXIS(A)] = 1;            \
     }
 
@@ -1477,8 +1501,23 @@ void Stepper::isr() {
     // Enable ISRs to reduce USART processing latency
     hal.isr_on();
 
+    #if ENABLED(FT_MOTION)
+      // Fixed-Time Motion takes the place of the pulse and block phases
+      if (!nextMainISR && FTMotion::active) nextMainISR = ft_motion_isr();
+    #endif
+
+    #if HAS_SHAPING
+      // Hold the pulse phase until the echoes make room for its steps
+      if (!nextMainISR && ShapingQueue::free_count() < steps_per_isr)
+        nextMainISR = _MAX(nextShapingISR, 1UL);
+    #endif
+
     if (!nextMainISR) pulse_phase_isr();                    // 0 = Do coordinated axes Stepper pulses
 
+    #if HAS_SHAPING
+      if (!nextShapingISR) nextShapingISR = shaping_isr();  // 0 = Do shaped XY pulses and echoes
+    #endif
+
     #if ENABLED(LIN_ADVANCE)
       if (!nextAdvanceISR) nextAdvanceISR = advance_isr();  // 0 = Do Linear Advance E Stepper pulses
     #endif
@@ -1506,6 +1545,7 @@ void Stepper::isr() {
       nextMainISR                                       // Time until the next Pulse / Block phase
       OPTARG(LIN_ADVANCE, nextAdvanceISR)               // Come back early for Linear Advance?
       OPTARG(INTEGRATED_BABYSTEPPING, nextBabystepISR)  // Come back early for Babystepping?
+      OPTARG(HAS_SHAPING, nextShapingISR)               // Come back early for an echo?
     );
 
     //
@@ -1525,6 +1565,11 @@ void Stepper::isr() {
       if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval;
     #endif
 
+    #if HAS_SHAPING
+      if (nextShapingISR != ShapingQueue::NEVER) nextShapingISR -= interval;
+      ShapingQueue::now += interval;
+    #endif
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -1638,6 +1683,9 @@ void Stepper::pulse_phase_isr() {
     USING_TIMED_PULSE();
   #endif
   xyze_bool_t step_needed{0};
+  #if HAS_SHAPING
+    uint8_t shaped_bits = 0;
+  #endif
 
   do {
     #define _APPLY_STEP(AXIS, INV, ALWAYS) AXIS ##_APPLY_STEP(INV, ALWAYS)
@@ -1653,6 +1701,17 @@ void Stepper::pulse_phase_isr() {
       } \
     }while(0)
 
+    // A shaped axis owes the first impulse of its step now and queues the step for the echoes
+    #define SHAPING_PREP(AXIS) do{ \
+      if (step_needed[_AXIS(AXIS)] && shaping[_AXIS(AXIS)].enabled) { \
+        step_needed[_AXIS(AXIS)] = false; \
+        shaping[_AXIS(AXIS)].owed += count_direction[_AXIS(AXIS)] * shaping[_AXIS(AXIS)].amplitude[0]; \
+        shaped_bits |= count_direction[_AXIS(AXIS)] < 0 \
+          ? SHAPING_STEP_BIT(_AXIS(AXIS)) | SHAPING_REV_BIT(_AXIS(AXIS)) \
+          : SHAPING_STEP_BIT(_AXIS(AXIS)); \
+      } \
+    }while(0)
+
     // Start an active pulse if needed
     #define PULSE_START(AXIS) do{ \
       if (step_needed[_AXIS(AXIS)]) { \
@@ -1780,9 +1839,15 @@ void Stepper::pulse_phase_isr() {
       // Determine if pulses are needed
       #if HAS_X_STEP
         PULSE_PREP(X);
+        #if ENABLED(INPUT_SHAPING_X)
+          SHAPING_PREP(X);
+        #endif
       #endif
       #if HAS_Y_STEP
         PULSE_PREP(Y);
+        #if ENABLED(INPUT_SHAPING_Y)
+          SHAPING_PREP(Y);
+        #endif
       #endif
       #if HAS_Z_STEP
         PULSE_PREP(Z);
@@ -1814,6 +1879,14 @@ void Stepper::pulse_phase_isr() {
       #endif
     }
 
+    #if HAS_SHAPING
+      if (shaped_bits) {
+        ShapingQueue::enqueue(shaped_bits);
+        shaped_bits = 0;
+        nextShapingISR = 0;
+      }
+    #endif
+
     #if ISR_MULTI_STEPS
       if (firstStep)
         firstStep = false;
@@ -2471,6 +2544,522 @@ uint32_t Stepper::block_phase_isr() {
 
 #endif // LIN_ADVANCE
 
+#if HAS_SHAPING
+
+  // Take a whole step when half a step or more is owed
+  FORCE_INLINE static bool take_owed_step(shaping_params_t &s) {
+    if (s.owed >= (SHAPING_SCALE) / 2) { s.owed -= SHAPING_SCALE; return true; }
+    if (s.owed < -((SHAPING_SCALE) / 2)) { s.owed += SHAPING_SCALE; return true; }
+    return false;
+  }
+
+  // Timer interrupt for the echoes and the steps owed by the shaped axes
+  uint32_t Stepper::shaping_isr() {
+    uint32_t interval = ShapingQueue::NEVER;
+
+    // Add the echoes that are due and find the next one
+    LOOP_L_N(c, SHAPING_CHANNELS) {
+      if (!TEST(ShapingQueue::active, c)) continue;
+      shaping_params_t &s = shaping[c / (SHAPING_ECHOES)];
+      const uint8_t k = c % (SHAPING_ECHOES);
+      for (;;) {
+        const uint32_t ticks = ShapingQueue::ticks_to_next(c, s.delay[k]);
+        if (ticks) { NOMORE(interval, ticks); break; }
+        const int16_t amp = s.amplitude[k + 1];
+        s.owed += ShapingQueue::dequeue(c) ? -amp : amp;
+      }
+    }
+
+    // Point the DIR outputs at the steps owed
+    bool dir_changed = false;
+    #define SHAPING_DIR(A) do{ \
+      shaping_params_t &s = shaping[_AXIS(A)]; \
+      const bool fwd = s.owed >= (SHAPING_SCALE) / 2, rev = s.owed < -((SHAPING_SCALE) / 2); \
+      if ((fwd && s.reverse) || (rev && !s.reverse)) { \
+        if (!dir_changed) { DIR_WAIT_BEFORE(); dir_changed = true; } \
+        A##_APPLY_DIR(rev ? INVERT_##A##_DIR : !INVERT_##A##_DIR, false); \
+        s.reverse = rev; \
+      } \
+    }while(0)
+
+    #if ENABLED(INPUT_SHAPING_X)
+      SHAPING_DIR(X);
+    #endif
+    #if ENABLED(INPUT_SHAPING_Y)
+      SHAPING_DIR(Y);
+    #endif
+    if (dir_changed) DIR_WAIT_AFTER();
+
+    #if ISR_MULTI_STEPS
+      bool firstStep = true;
+      USING_TIMED_PULSE();
+    #endif
+
+    for (;;) {
+      const bool step_x = TERN0(INPUT_SHAPING_X, take_owed_step(shaping[X_AXIS])),
+                 step_y = TERN0(INPUT_SHAPING_Y, take_owed_step(shaping[Y_AXIS]));
+      if (!step_x && !step_y) break;
+
+      #if ISR_MULTI_STEPS
+        if (firstStep)
+          firstStep = false;
+        else
+          AWAIT_LOW_PULSE();
+      #endif
+
+      #if ENABLED(INPUT_SHAPING_X)
+        if (step_x) X_APPLY_STEP(!INVERT_X_STEP_PIN, 0);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        if (step_y) Y_APPLY_STEP(!INVERT_Y_STEP_PIN, 0);
+      #endif
+
+      #if ISR_PULSE_CONTROL
+        START_HIGH_PULSE();
+        AWAIT_HIGH_PULSE();
+      #endif
+
+      #if ENABLED(INPUT_SHAPING_X)
+        if (step_x) X_APPLY_STEP(INVERT_X_STEP_PIN, 0);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        if (step_y) Y_APPLY_STEP(INVERT_Y_STEP_PIN, 0);
+      #endif
+
+      #if ISR_MULTI_STEPS
+        START_LOW_PULSE();
+      #endif
+    }
+
+    return interval;
+  }
+
+  bool Stepper::shaping_busy() {
+    return ShapingQueue::used()
+      || TERN0(INPUT_SHAPING_X, shaping[X_AXIS].owed)
+      || TERN0(INPUT_SHAPING_Y, shaping[Y_AXIS].owed);
+  }
+
+  /**
+   * Compute the impulses of an axis from its frequency, damping ratio and type.
+   * The amplitudes and delays (in damped periods) are those of the usual
+   * ZV, ZVD, MZV and EI (5% vibration tolerance) shapers.
+   * Call with the queue empty and the Stepper ISR suspended.
+   */
+  void Stepper::update_shaping(const AxisEnum axis) {
+    shaping_params_t &s = shaping[axis];
+
+    const bool was_enabled = s.enabled;
+    s.enabled = s.frequency > 0;
+
+    const float df = SQRT(1.0f - sq(s.zeta)),
+                K = expf(-s.zeta * float(M_PI) / df);
+
+    float amp[1 + SHAPING_ECHOES], when[SHAPING_ECHOES];
+    uint8_t n;
+    switch (s.type) {
+      default:
+      case SHAPER_ZV:
+        n = 2;
+        amp[0] = 1; amp[1] = K;
+        when[0] = 0.5f;
+        break;
+      case SHAPER_ZVD:
+        n = 3;
+        amp[0] = 1; amp[1] = 2 * K; amp[2] = sq(K);
+        when[0] = 0.5f; when[1] = 1;
+        break;
+      case SHAPER_MZV: {
+        const float K2 = expf(-0.75f * s.zeta * float(M_PI) / df), a = 1 - float(M_SQRT1_2);
+        n = 3;
+        amp[0] = a; amp[1] = (float(M_SQRT2) - 1) * K2; amp[2] = a * sq(K2);
+        when[0] = 0.375f; when[1] = 0.75f;
+      } break;
+      case SHAPER_EI: {
+        constexpr float v = 0.05f;
+        n = 3;
+        amp[0] = 0.25f * (1 + v); amp[1] = 0.5f * (1 - v) * K; amp[2] = amp[0] * sq(K);
+        when[0] = 0.5f; when[1] = 1;
+      } break;
+    }
+
+    // Scale the amplitudes to add up to exactly one step
+    float total = 0;
+    LOOP_L_N(i, n) total += amp[i];
+    int16_t sum = 0;
+    LOOP_L_N(i, n - 1) sum += s.amplitude[i] = int16_t(LROUND(amp[i] * (SHAPING_SCALE) / total));
+    s.amplitude[n - 1] = SHAPING_SCALE - sum;
+
+    const float period = s.enabled ? (STEPPER_TIMER_RATE) / (s.frequency * df) : 0;
+    LOOP_L_N(k, n - 1) s.delay[k] = uint32_t(LROUND(when[k] * period));
+
+    s.echoes = n - 1;
+    s.owed = 0;
+
+    // Start from a known DIR output
+    s.reverse = motor_direction(axis);
+    if (s.enabled) switch (axis) {
+      #if ENABLED(INPUT_SHAPING_X)
+        case X_AXIS: X_APPLY_DIR(s.reverse ? INVERT_X_DIR : !INVERT_X_DIR, false); break;
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        case Y_AXIS: Y_APPLY_DIR(s.reverse ? INVERT_Y_DIR : !INVERT_Y_DIR, false); break;
+      #endif
+      default: break;
+    }
+    LOOP_L_N(k, SHAPING_ECHOES) {
+      const uint8_t c = axis * (SHAPING_ECHOES) + k;
+      ShapingQueue::sync(c);
+      SET_BIT_TO(ShapingQueue::active, c, s.enabled && k < s.echoes);
+    }
+
+    // Give the DIR output back to the pulse phase
+    if (was_enabled && !s.enabled) set_directions();
+  }
+
+  void Stepper::set_shaping_frequency(const AxisEnum axis, const float freq) {
+    planner.synchronize();  // Let the queued moves and their echoes finish
+    const bool was_on = suspend();
+    shaping[axis].frequency = freq;
+    update_shaping(axis);
+    if (was_on) wake_up();
+  }
+
+  void Stepper::set_shaping_damping_ratio(const AxisEnum axis, const float zeta) {
+    planner.synchronize();
+    const bool was_on = suspend();
+    shaping[axis].zeta = zeta;
+    update_shaping(axis);
+    if (was_on) wake_up();
+  }
+
+  void Stepper::set_shaping_type(const AxisEnum axis, const ShaperType type) {
+    planner.synchronize();
+    const bool was_on = suspend();
+    shaping[axis].type = type;
+    update_shaping(axis);
+    if (was_on) wake_up();
+  }
+
+#endif // HAS_SHAPING
+
+#if ENABLED(FT_MOTION)
+
+  /**
+   * Play the frames computed by FTMotion. Each call is one of the
+   * FTM_STEPS_PER_FRAME slots of a frame, and an accumulator per axis
+   * spreads the steps of the frame evenly over the slots. The interval
+   * never changes, so there is no speed math here.
+   */
+  uint32_t Stepper::ft_motion_isr() {
+    static ft_frame_t frame;
+    static uint8_t slot;                    // The slot in the frame being played
+    static uint16_t accu[LOGICAL_AXES];
+
+    if (TERN0(FTM_STEP_DMA, ft_dma_ok)) return TERN0(FTM_STEP_DMA, ft_dma_isr());
+
+    // An endstop hit or quick_stop drops all the frames
+    if (abort_current_block) {
+      abort_current_block = false;
+      FTMotion::abort();
+      slot = 0;
+    }
+
+    if (!slot) {
+      // Wait for the next frame
+      if (FTMotion::frame_tail == FTMotion::frame_head || TERN0(FREEZE_FEATURE, frozen)) {
+        axis_did_move = 0;
+        return FTM_ISR_TICKS;
+      }
+
+      frame = FTMotion::frames[FTMotion::frame_tail];
+      axis_did_move = frame.move_bits;
+
+      #if HAS_MULTI_EXTRUDER
+        const bool new_extruder = frame.extruder != stepper_extruder;
+        stepper_extruder = last_moved_extruder = frame.extruder;
+      #else
+        constexpr bool new_extruder = false;
+      #endif
+      if (new_extruder || frame.dir_bits != last_direction_bits)
+        set_directions(frame.dir_bits);
+
+      LOOP_LOGICAL_AXES(a) accu[a] = (FTM_STEPS_PER_FRAME) / 2;
+    }
+
+    axis_bits_t step_bits = 0;
+    LOOP_LOGICAL_AXES(a) {
+      accu[a] += frame.steps[a];
+      if (accu[a] >= FTM_STEPS_PER_FRAME) {
+        accu[a] -= FTM_STEPS_PER_FRAME;
+        SBI(step_bits, a);
+        count_position[a] += count_direction[a];
+      }
+    }
+
+    if (step_bits) {
+      #define FTM_PULSE(A, V) do{ if (TEST(step_bits, _AXIS(A))) A##_APPLY_STEP(V, 0); }while(0)
+
+      #if ISR_MULTI_STEPS
+        USING_TIMED_PULSE();
+      #endif
+
+      #if HAS_X_STEP
+        FTM_PULSE(X, !INVERT_X_STEP_PIN);
+      #endif
+      #if HAS_Y_STEP
+        FTM_PULSE(Y, !INVERT_Y_STEP_PIN);
+      #endif
+      #if HAS_Z_STEP
+        FTM_PULSE(Z, !INVERT_Z_STEP_PIN);
+      #endif
+      #if HAS_I_STEP
+        FTM_PULSE(I, !INVERT_I_STEP_PIN);
+      #endif
+      #if HAS_J_STEP
+        FTM_PULSE(J, !INVERT_J_STEP_PIN);
+      #endif
+      #if HAS_K_STEP
+        FTM_PULSE(K, !INVERT_K_STEP_PIN);
+      #endif
+      #if HAS_E0_STEP
+        FTM_PULSE(E, !INVERT_E_STEP_PIN);
+      #endif
+
+      TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
+
+      #if ISR_MULTI_STEPS
+        START_HIGH_PULSE();
+        AWAIT_HIGH_PULSE();
+      #endif
+
+      #if HAS_X_STEP
+        FTM_PULSE(X, INVERT_X_STEP_PIN);
+      #endif
+      #if HAS_Y_STEP
+        FTM_PULSE(Y, INVERT_Y_STEP_PIN);
+      #endif
+      #if HAS_Z_STEP
+        FTM_PULSE(Z, INVERT_Z_STEP_PIN);
+      #endif
+      #if HAS_I_STEP
+        FTM_PULSE(I, INVERT_I_STEP_PIN);
+      #endif
+      #if HAS_J_STEP
+        FTM_PULSE(J, INVERT_J_STEP_PIN);
+      #endif
+      #if HAS_K_STEP
+        FTM_PULSE(K, INVERT_K_STEP_PIN);
+      #endif
+      #if HAS_E0_STEP
+        FTM_PULSE(E, INVERT_E_STEP_PIN);
+      #endif
+    }
+
+    // Frame done. Release the blocks that ended in it.
+    if (++slot == FTM_STEPS_PER_FRAME) {
+      slot = 0;
+      LOOP_L_N(i, frame.blocks_done) {
+        TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, runout.block_completed(&planner.block_buffer[planner.block_buffer_tail]));
+        planner.release_current_block();
+      }
+      FTMotion::frame_tail = FTMotion::next_frame_index(FTMotion::frame_tail);
+    }
+
+    return FTM_ISR_TICKS;
+  }
+
+  #if ENABLED(FTM_STEP_DMA)
+
+    /**
+     * Play the frames by DMA. Each half of the pattern buffer holds one frame
+     * as words for the GPIO port: the DIR outputs, then a STEP on and a STEP off
+     * word for each slot. The ISR checks twice per frame for a half the DMA has
+     * played and fills it with the next frame, or with idle words.
+     *
+     * The steps of a frame are counted when it goes into the buffer, so the
+     * position runs up to two frames ahead of the motors. A stop takes back
+     * the steps that didn't go out.
+     */
+    bool Stepper::ft_dma_ok; // = false
+
+    static step_dma_word_t ft_dma_buffer[2][FTM_DMA_WORDS];
+    static step_dma_word_t ft_step_on[LOGICAL_AXES], ft_step_off[LOGICAL_AXES],
+                           ft_dir_fwd[LOGICAL_AXES], ft_dir_rev[LOGICAL_AXES];
+    static struct {
+      bool live;                            // Holds a frame not yet fully played
+      axis_bits_t dir_bits, move_bits;
+    } ft_dma_half[2];
+    static uint8_t ft_dma_next;             // The half to fill once the DMA leaves it
+    static bool ft_dma_running;
+
+    // Get the pattern bits of the STEP and DIR pins. If a pin can't be mapped the ISR plays the frames.
+    void Stepper::ft_dma_init() {
+      bool ok = true;
+      auto map_axis = [&](const AxisEnum a, const pin_t step_pin, const pin_t dir_pin, const bool inv_step, const bool inv_dir) {
+        const int8_t s = step_dma_lane(step_pin), d = step_dma_lane(dir_pin);
+        if (s < 0 || d < 0) { ok = false; return; }
+        ft_step_on[a]  |= inv_step ? STEP_DMA_CLEAR(s) : STEP_DMA_SET(s);
+        ft_step_off[a] |= inv_step ? STEP_DMA_SET(s) : STEP_DMA_CLEAR(s);
+        ft_dir_rev[a]  |= inv_dir ? STEP_DMA_SET(d) : STEP_DMA_CLEAR(d);
+        ft_dir_fwd[a]  |= inv_dir ? STEP_DMA_CLEAR(d) : STEP_DMA_SET(d);
+      };
+
+      // The extra steppers of an axis share its pattern bits
+      #define _FTM_DMA_MAP(A) map_axis(_AXIS(A), A##_STEP_PIN, A##_DIR_PIN, INVERT_##A##_STEP_PIN, INVERT_##A##_DIR)
+      #define _FTM_DMA_MAP_N(A,N) map_axis(_AXIS(A), A##N##_STEP_PIN, A##N##_DIR_PIN, INVERT_##A##_STEP_PIN, INVERT_##A##_DIR ^ ENABLED(INVERT_##A##N##_VS_##A##_DIR))
+      #if HAS_X_STEP
+        _FTM_DMA_MAP(X);
+        TERN_(HAS_X2_STEPPER, _FTM_DMA_MAP_N(X, 2));
+      #endif
+      #if HAS_Y_STEP
+        _FTM_DMA_MAP(Y);
+        TERN_(HAS_DUAL_Y_STEPPERS, _FTM_DMA_MAP_N(Y, 2));
+      #endif
+      #if HAS_Z_STEP
+        _FTM_DMA_MAP(Z);
+        #if NUM_Z_STEPPERS >= 2
+          _FTM_DMA_MAP_N(Z, 2);
+        #endif
+        #if NUM_Z_STEPPERS >= 3
+          _FTM_DMA_MAP_N(Z, 3);
+        #endif
+        #if NUM_Z_STEPPERS >= 4
+          _FTM_DMA_MAP_N(Z, 4);
+        #endif
+      #endif
+      #if HAS_I_STEP
+        _FTM_DMA_MAP(I);
+      #endif
+      #if HAS_J_STEP
+        _FTM_DMA_MAP(J);
+      #endif
+      #if HAS_K_STEP
+        _FTM_DMA_MAP(K);
+      #endif
+      #if HAS_E0_STEP
+        map_axis(E_AXIS, E0_STEP_PIN, E0_DIR_PIN, INVERT_E_STEP_PIN, INVERT_E0_DIR);
+      #endif
+      #undef _FTM_DMA_MAP
+      #undef _FTM_DMA_MAP_N
+
+      ft_dma_ok = ok;
+      if (!ok) SERIAL_ECHO_MSG("FTM_STEP_DMA needs all STEP/DIR pins on one port. Using the stepper ISR.");
+    }
+
+    // Fill a half of the pattern buffer with the next frame and count its steps
+    void Stepper::ft_dma_fill(const uint8_t h) {
+      step_dma_word_t * const w = ft_dma_buffer[h];
+
+      if (FTMotion::frame_tail == FTMotion::frame_head || TERN0(FREEZE_FEATURE, frozen)) {
+        LOOP_L_N(i, FTM_DMA_WORDS) w[i] = 0;
+        ft_dma_half[h].live = false;
+        return;
+      }
+
+      const ft_frame_t &frame = FTMotion::frames[FTMotion::frame_tail];
+      ft_dma_half[h] = { true, frame.dir_bits, frame.move_bits };
+      last_direction_bits = frame.dir_bits;
+
+      step_dma_word_t dir_word = 0;
+      uint16_t accu[LOGICAL_AXES];
+      LOOP_LOGICAL_AXES(a) {
+        const bool rev = TEST(frame.dir_bits, a);
+        count_direction[a] = rev ? -1 : 1;
+        dir_word |= rev ? ft_dir_rev[a] : ft_dir_fwd[a];
+        accu[a] = (FTM_STEPS_PER_FRAME) / 2;
+      }
+      w[0] = dir_word;
+
+      for (uint16_t i = 1; i < FTM_DMA_WORDS; i += 2) {
+        step_dma_word_t on = 0, off = 0;
+        LOOP_LOGICAL_AXES(a) {
+          accu[a] += frame.steps[a];
+          if (accu[a] >= FTM_STEPS_PER_FRAME) {
+            accu[a] -= FTM_STEPS_PER_FRAME;
+            on |= ft_step_on[a];
+            off |= ft_step_off[a];
+            count_position[a] += count_direction[a];
+          }
+        }
+        w[i] = on;
+        w[i + 1] = off;
+      }
+
+      LOOP_L_N(i, frame.blocks_done) {
+        TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, runout.block_completed(&planner.block_buffer[planner.block_buffer_tail]));
+        planner.release_current_block();
+      }
+      FTMotion::frame_tail = FTMotion::next_frame_index(FTMotion::frame_tail);
+    }
+
+    // Stop the DMA, end any STEP pulse, and take back the steps not played
+    void Stepper::ft_dma_abort() {
+      if (ft_dma_running) {
+        ft_dma_running = false;
+        const uint16_t next = step_dma_stop();
+
+        step_dma_word_t off = 0;
+        LOOP_LOGICAL_AXES(a) off |= ft_step_off[a];
+        step_dma_write(off);
+
+        auto uncount = [](const uint8_t h, const uint16_t from) {
+          if (!ft_dma_half[h].live) return;
+          for (uint16_t i = from | 1; i < FTM_DMA_WORDS; i += 2) {
+            const step_dma_word_t on = ft_dma_buffer[h][i];
+            if (on) LOOP_LOGICAL_AXES(a)
+              if (on & ft_step_on[a]) count_position[a] += TEST(ft_dma_half[h].dir_bits, a) ? 1 : -1;
+          }
+        };
+        const uint8_t h = next / (FTM_DMA_WORDS);
+        uncount(h, next % (FTM_DMA_WORDS));
+        if (ft_dma_next == h) uncount(h ^ 1, 0);  // The other half was filled and is still to play
+
+        // Leave the DIR outputs as counted
+        set_directions();
+      }
+      ft_dma_half[0].live = ft_dma_half[1].live = false;
+      FTMotion::dma_frames = 0;
+      axis_did_move = 0;
+    }
+
+    uint32_t Stepper::ft_dma_isr() {
+      // An endstop hit or quick_stop drops all the frames
+      if (abort_current_block) {
+        abort_current_block = false;
+        ft_dma_abort();
+        FTMotion::abort();
+      }
+
+      if (!ft_dma_running) {
+        if (FTMotion::frame_tail == FTMotion::frame_head || TERN0(FREEZE_FEATURE, frozen))
+          return FTM_DMA_CHECK_TICKS;
+        ft_dma_fill(0);
+        ft_dma_fill(1);
+        ft_dma_next = 0;
+        ft_dma_running = true;
+        step_dma_start(ft_dma_buffer[0], FTM_DMA_WORDS, FTM_DMA_RATE);
+      }
+      else if (step_dma_position() / (FTM_DMA_WORDS) != ft_dma_next) {
+        ft_dma_fill(ft_dma_next);
+        ft_dma_next ^= 1;
+        // Stop once the half playing now is idle too
+        if (!ft_dma_half[0].live && !ft_dma_half[1].live) {
+          step_dma_stop();
+          ft_dma_running = false;
+        }
+      }
+
+      FTMotion::dma_frames = ft_dma_half[0].live + ft_dma_half[1].live;
+      axis_did_move = (ft_dma_half[0].live ? ft_dma_half[0].move_bits : 0)
+                    | (ft_dma_half[1].live ? ft_dma_half[1].move_bits : 0);
+      return FTM_DMA_CHECK_TICKS;
+    }
+
+  #endif // FTM_STEP_DMA
+
+#endif // FT_MOTION
+
 #if ENABLED(INTEGRATED_BABYSTEPPING)
 
   // Timer interrupt for baby-stepping
@@ -2485,6 +3074,13 @@ uint32_t Stepper::block_phase_isr() {
 // The current_block could change in the middle of the read by an Stepper ISR, so
 // we must explicitly prevent that!
 bool Stepper::is_block_busy(const block_t * const block) {
+  #if ENABLED(FT_MOTION)
+    // Fixed-Time Motion holds every block it has read until its frames are played
+    if (FTMotion::active)
+      return BLOCK_MOD(uint8_t(block - planner.block_buffer) - planner.block_buffer_tail)
+           < BLOCK_MOD(planner.block_buffer_nonbusy - planner.block_buffer_tail);
+  #endif
+
   #ifdef __AVR__
     // A SW memory barrier, to ensure GCC does not overoptimize loops
     #define sw_barrier() asm volatile("": : :"memory");
@@ -2734,6 +3330,8 @@ void Stepper::init() {
     E_AXIS_INIT(7);
   #endif
 
+  TERN_(FTM_STEP_DMA, ft_dma_init());
+
   #if DISABLED(I2S_STEPPER_STREAM)
     HAL_timer_start(MF_TIMER_STEP, 122); // Init Stepper ISR to 122 Hz for quick starting
     wake_up();
@@ -2845,6 +3443,10 @@ void Stepper::set_axis_position(const AxisEnum a, const int32_t &v) {
 void Stepper::endstop_triggered(const AxisEnum axis) {
 
   const bool was_enabled = suspend();
+
+  // Stop the pattern DMA first, so the position is where the motors stopped
+  TERN_(FTM_STEP_DMA, if (ft_dma_ok && FTMotion::active) ft_dma_abort());
+
   endstops_trigsteps[axis] = (
     #if IS_CORE
       (axis == CORE_AXIS_2
@@ -299,10 +299,113 @@ constexpr ena_mask_t enable_overlap[] = {
 
 //static_assert(!any_enable_overlap(), "There is some overlap.");
 
+#if HAS_SHAPING
+
+  /**
+   * Input Shaping
+   *
+   * The steps of a shaped axis are played as a train of impulses. The pulse
+   * phase plays the first impulse right away and queues the step. The shaping
+   * phase plays each echo when the queued step is as old as the echo's delay.
+   * The impulses of a step add up to SHAPING_SCALE and the shaped axis takes a
+   * whole step when the sum it is owed reaches half a step, so the motor ends
+   * every move on the position counted by the pulse phase.
+   */
+
+  #define SHAPING_ECHOES   2                // Most impulses after the first, for ZVD, MZV and EI
+  #define SHAPING_CHANNELS (2 * (SHAPING_ECHOES)) // One queue reader per XY axis and echo
+  #define SHAPING_SCALE    1024             // One step in impulse amplitude units
+
+  #ifndef SHAPING_BUFFER_SIZE
+    // Room for the steps of both axes at full speed over the longest echo delay
+    constexpr float _shaping_max_feedrate[] = DEFAULT_MAX_FEEDRATE,
+                    _shaping_steps_per_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+    #define SHAPING_BUFFER_SIZE uint16_t((0 \
+        + TERN0(INPUT_SHAPING_X, _shaping_max_feedrate[X_AXIS] * _shaping_steps_per_mm[X_AXIS]) \
+        + TERN0(INPUT_SHAPING_Y, _shaping_max_feedrate[Y_AXIS] * _shaping_steps_per_mm[Y_AXIS]) \
+      ) * 1.1f / (SHAPING_MIN_FREQ) + 3)
+  #endif
+
+  #define SHAPING_STEP_BIT(A) _BV(2 * (A))
+  #define SHAPING_REV_BIT(A)  _BV(2 * (A) + 1)
+
+  // Shaped steps waiting for their echoes. Each channel reads the queue at its own delay.
+  class ShapingQueue {
+    public:
+      static constexpr uint32_t NEVER = 0xFFFFFFFF;
+
+      static uint32_t now;                  // Stepper timer ticks, advanced by the Stepper ISR
+      static uint8_t active;                // Channels with an echo to play, one bit each
+
+      // Queue the steps of one step event: SHAPING_STEP_BIT / SHAPING_REV_BIT per axis
+      FORCE_INLINE static void enqueue(const uint8_t bits) {
+        times[tail] = now;
+        events[tail] = bits;
+        tail = next(tail);
+      }
+
+      // Ticks until the next step of channel c is due, 0 if it is due now, or NEVER
+      FORCE_INLINE static uint32_t ticks_to_next(const uint8_t c, const uint32_t delay) {
+        const uint8_t bit = SHAPING_STEP_BIT(c / (SHAPING_ECHOES));
+        uint16_t h = head[c];
+        while (h != tail && !(events[h] & bit)) h = next(h);   // Skip the other axis
+        head[c] = h;
+        if (h == tail) return NEVER;
+        const int32_t ticks = int32_t(times[h] + delay - now);
+        return ticks > 0 ? uint32_t(ticks) : 0;
+      }
+
+      // Take the due step of channel c. Return true if it is a reverse step.
+      FORCE_INLINE static bool dequeue(const uint8_t c) {
+        const bool rev = events[head[c]] & SHAPING_REV_BIT(c / (SHAPING_ECHOES));
+        head[c] = next(head[c]);
+        return rev;
+      }
+
+      // Events still held for the slowest active channel
+      static uint16_t used() {
+        uint16_t n = 0;
+        LOOP_L_N(c, SHAPING_CHANNELS) if (TEST(active, c)) {
+          int16_t d = int16_t(tail) - int16_t(head[c]);
+          if (d < 0) d += SHAPING_BUFFER_SIZE;
+          NOLESS(n, uint16_t(d));
+        }
+        return n;
+      }
+      static uint16_t free_count() { return (SHAPING_BUFFER_SIZE) - 1 - used(); }
+
+      // Drop the history of a channel, e.g., when it becomes active
+      static void sync(const uint8_t c) { head[c] = tail; }
+
+    private:
+      static uint32_t times[SHAPING_BUFFER_SIZE];
+      static uint8_t events[SHAPING_BUFFER_SIZE];
+      static uint16_t tail, head[SHAPING_CHANNELS];
+
+      FORCE_INLINE static uint16_t next(const uint16_t i) { return i + 1 < (SHAPING_BUFFER_SIZE) ? i + 1 : 0; }
+  };
+
+  typedef struct {
+    float frequency,                        // (Hz) 0 = Not shaped
+          zeta;                             // Damping ratio
+    ShaperType type;
+    bool enabled;
+    uint8_t echoes;                         // Impulses after the first one
+    int16_t amplitude[1 + SHAPING_ECHOES];  // Impulse amplitudes, adding up to SHAPING_SCALE
+    uint32_t delay[SHAPING_ECHOES];         // Echo delays in Stepper timer ticks
+    int32_t owed;                           // Shaped steps not yet taken, in SHAPING_SCALE units
+    bool reverse;                           // State of the DIR output, set by the shaping phase
+  } shaping_params_t;
+
+#endif // HAS_SHAPING
+
 //
 // Stepper class definition
 //
 class Stepper {
+  #if ENABLED(FT_MOTION)
+    friend class FTMotion;
+  #endif
 
   public:
 
@@ -413,6 +516,12 @@ class Stepper {
       static uint32_t nextBabystepISR;
     #endif
 
+    #if HAS_SHAPING
+      static shaping_params_t shaping[2];   // Indexed by X_AXIS and Y_AXIS
+      static uint32_t nextShapingISR;
+      static void update_shaping(const AxisEnum axis);
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
     #endif
@@ -431,6 +540,14 @@ class Stepper {
     // Current stepper motor directions (+1 or -1)
     static xyze_int8_t count_direction;
 
+    #if ENABLED(FTM_STEP_DMA)
+      static bool ft_dma_ok;                // The STEP/DIR pins are mapped for the pattern DMA
+      static void ft_dma_init();
+      static uint32_t ft_dma_isr();
+      static void ft_dma_fill(const uint8_t h);
+      static void ft_dma_abort();
+    #endif
+
   public:
     // Initialize stepper hardware
     static void init();
@@ -464,6 +581,27 @@ class Stepper {
       FORCE_INLINE static void initiateLA() { nextAdvanceISR = 0; }
     #endif
 
+    #if HAS_SHAPING
+      // The Input Shaping ISR phase
+      static uint32_t shaping_isr();
+
+      // Shaping parameters. Changes wait for the queued moves and echoes to finish.
+      static void set_shaping_frequency(const AxisEnum axis, const float freq);
+      static void set_shaping_damping_ratio(const AxisEnum axis, const float zeta);
+      static void set_shaping_type(const AxisEnum axis, const ShaperType type);
+      static float get_shaping_frequency(const AxisEnum axis) { return shaping[axis].frequency; }
+      static float get_shaping_damping_ratio(const AxisEnum axis) { return shaping[axis].zeta; }
+      static ShaperType get_shaping_type(const AxisEnum axis) { return shaping[axis].type; }
+
+      // True while echoes are still to be played
+      static bool shaping_busy();
+    #endif
+
+    #if ENABLED(FT_MOTION)
+      // The Fixed-Time Motion ISR phase, replacing the pulse and block phases
+      static uint32_t ft_motion_isr();
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       // The Babystepping ISR phase
       static uint32_t babystepping_isr();
@@ -178,6 +178,10 @@
   #include "../feature/joystick.h"
 #endif
 
+#if ENABLED(BED_ZONE_FOOTPRINT)
+  #include "../feature/bed_footprint.h"
+#endif
+
 #if ENABLED(SINGLENOZZLE)
   #include "tool_change.h"
 #endif
@@ -199,127 +203,289 @@
   constexpr uint8_t BED3_PCF_BIT = 3; 
 
   #if ADS1115_BED_READING
-  // Define static ADS1115 instance
-  Adafruit_ADS1115 Temperature::bedADS;
-  #endif
-
-  #if PCF8574_BED_CONTROL
-  // Define static PCF8574 instance with I2C address
-  PCF8574 Temperature::bedPCF(PCF8574_ADDRESS, &Wire);
-  #endif  
 
-  #if ADS1115_BED_READING || PCF8574_BED_CONTROL
-    void Temperature::initWireI2C() {
-      Wire.begin(); 
+    #if PIN_EXISTS(ADS1115_RDY)
+      #define ADS1115_HAS_RDY 1
+    #endif
+
+    // ADS1115 registers and configuration bits
+    #define ADS1115_REG_CONVERSION    0x00
+    #define ADS1115_REG_CONFIG        0x01
+    #define ADS1115_REG_LO_THRESH     0x02
+    #define ADS1115_REG_HI_THRESH     0x03
+    #define ADS1115_CFG_OS            0x8000  // Write: start a conversion. Read: conversion done.
+    #define ADS1115_CFG_MUX_SINGLE(N) (0x4000 | ((N) << 12))
+    #define ADS1115_CFG_PGA_4_096V    0x0200  // GAIN_ONE
+    #define ADS1115_CFG_MODE_SINGLE   0x0100
+    #define ADS1115_CFG_DR(N)         ((N) << 5)  // Data rate index 0-7
+    #define ADS1115_CFG_CQUE_1CONV    0x0000  // ALERT/RDY goes low after each conversion
+    #define ADS1115_CFG_CQUE_NONE     0x0003
+
+    #define ADS1115_CONFIG (ADS1115_CFG_OS | ADS1115_CFG_PGA_4_096V | ADS1115_CFG_MODE_SINGLE \
+                            | TERN(ADS1115_HAS_RDY, ADS1115_CFG_CQUE_1CONV, ADS1115_CFG_CQUE_NONE))
+
+    static I2CStatus ads1115_write_reg(const uint8_t reg, const uint16_t val) {
+      const uint8_t tx[] = { reg, uint8_t(val >> 8), uint8_t(val & 0xFF) };
+      return i2c_async.run(ADS1115_ADDRESS, tx, COUNT(tx));
     }
-  #endif
-  /*
-  #define RATE_ADS1115_8SPS (0x0000)   ///< 8 samples per second
-  #define RATE_ADS1115_16SPS (0x0020)  ///< 16 samples per second
-  #define RATE_ADS1115_32SPS (0x0040)  ///< 32 samples per second
-  #define RATE_ADS1115_64SPS (0x0060)  ///< 64 samples per second
-  #define RATE_ADS1115_128SPS (0x0080) ///< 128 samples per second (default)
-  #define RATE_ADS1115_250SPS (0x00A0) ///< 250 samples per second
-  #define RATE_ADS1115_475SPS (0x00C0) ///< 475 samples per second
-  #define RATE_ADS1115_860SPS (0x00E0) ///< 860 samples per second
-
-  GAIN_TWOTHIRDS   6.144  
-  GAIN_ONE         4.096
-  GAIN_TWO         2.048
-  GAIN_FOUR        1.024
-  GAIN_EIGHT       0.512
-  GAIN_SIXTEEN     0.256
-    */
-  #if ADS1115_BED_READING
+
     void Temperature::initADS1115() {
-      if (!bedADS.begin(ADS1115_ADDRESS, &Wire)) {
-        SERIAL_ECHOLNPGM("Error initializing ADS1115");
-      }
-      // Configure ADS gain and data rate
-      bedADS.setGain(GAIN_ONE);       // ±4.096V full-scale range
-      bedADS.setDataRate(RATE_ADS1115_128SPS);
-    } 
-
-    void Temperature::read_bed_temperatures_ADS1115() {
-      int16_t raw16_ADS1115;
-
-      //Como tensão máxima ≃ 3.3 V/4.096V(GAIN ONE) * ≃ 26430 
-
-      constexpr uint16_t ADS_MAX_RANGE_3V3 = 26430; //≃ 26430 
-
-      for (uint8_t i = 0; i < BED_COUNT; ++i) {
-        raw16_ADS1115 = bedADS.readADC_SingleEnded(i);
-
-        //Tornando entrada 16bits em 32bits para calculos intermediarios(evitar overflow)
-        uint32_t raw32_ADS1115 = uint32_t(raw16_ADS1115);
-        // Garante valor positivo
-        if (raw16_ADS1115 < 0) raw16_ADS1115 = 0;
-
-        /*16 → 10 bits
-        uint16_t raw10_ADS1115 = uint16_t(raw16_ADS1115) >> 5;
-        temp_bed[i].setraw(raw10_ADS1115);   
-
-         1) Normalize 16-bit (0…32767) → 10-bit        
-        */
-        uint16_t raw10_ADS1115 = raw32_ADS1115 * 1023 / ADS_MAX_RANGE_3V3;
-
-        // 2) Apply oversampling factor 16 → faixa 0…1023·16 (0…16368)
-        uint16_t scaled = raw10_ADS1115 * OVERSAMPLENR;
-
-        // 3) Seta na estrutura das camas aquecidas o valor bruto de 10 bits lido pelo
-        // ADS1115 ou o valor escalado com OVERSAMPLENR(16);
-
-        //temp_bed[i].setraw(raw10_ADS1115);            
-        temp_bed[i].setraw(scaled);
- 
-        // Opcional: debug, só se quiser
-        #if SERIAL_MULTI_BEDS
-          SERIAL_ECHOPGM("ADS Cama "); SERIAL_ECHO(i);              
-          SERIAL_ECHOPGM("Sinal 10bits: "); SERIAL_ECHOLN(raw10_ADS1115);   
-          SERIAL_ECHOPGM("Sinal 16bits:"); SERIAL_ECHOLN(raw16_ADS1115);
-          SERIAL_ECHOPGM("Sinal 32bits:"); SERIAL_ECHOLN(raw32_ADS1115);           
-          SERIAL_ECHOPGM("Sinal escalado:"); SERIAL_ECHOLN(scaled);           
-        #endif
+      // Thresholds with opposite sign bits turn ALERT/RDY into a conversion-ready output
+      if (ads1115_write_reg(ADS1115_REG_HI_THRESH, 0x8000) != I2C_DONE
+          || ads1115_write_reg(ADS1115_REG_LO_THRESH, 0x0000) != I2C_DONE
+      ) SERIAL_ECHOLNPGM("Error initializing ADS1115");
+      #if ADS1115_HAS_RDY
+        SET_INPUT_PULLUP(ADS1115_RDY_PIN);
+      #endif
+    }
+
+    Temperature::ads1115_settings_t Temperature::ads1115_settings; // Initialized by settings.load()
+
+    static const uint16_t ads1115_rates[] PROGMEM = { 8, 16, 32, 64, 128, 250, 475, 860 };
+
+    uint16_t Temperature::ads1115_sps(const uint8_t rate) { return pgm_read_word(&ads1115_rates[_MIN(rate, 7)]); }
+
+    void Temperature::reset_ads1115_settings() {
+      uint8_t rate = 0;
+      while (rate < 7 && ads1115_sps(rate) < (ADS1115_DATA_RATE)) rate++;
+      ads1115_settings = { rate, ADS1115_SAMPLES, ADS1115_IIR_SHIFT };
+      ads1115_reset_filters();
+    }
+
+    // Time for one single-shot conversion, with margin for the internal oscillator
+    static millis_t ads1115_conversion_ms(const uint8_t rate) {
+      return 1000UL / thermalManager.ads1115_sps(rate) + 1;
+    }
+
+    millis_t Temperature::ads1115_sweep_ms(const ads1115_settings_t &s) {
+      return ads1115_conversion_ms(s.data_rate) * s.samples * (BED_COUNT);
+    }
+
+    millis_t Temperature::bed_sample_ms[BED_COUNT]; // = { 0 }
+
+    // Filtered reading of each bed in raw units << 8. 0 until the first reading.
+    static int32_t ads_filtered[BED_COUNT];
+
+    void Temperature::ads1115_reset_filters() { ZERO(ads_filtered); }
+
+    // Median of the conversions taken for one reading. Sorts the samples in place.
+    static int16_t ads1115_median(int16_t * const v, const uint8_t n) {
+      for (uint8_t i = 1; i < n; ++i)
+        for (uint8_t j = i; j && v[j - 1] > v[j]; --j) { const int16_t t = v[j]; v[j] = v[j - 1]; v[j - 1] = t; }
+      return (n & 1) ? v[n >> 1] : int16_t((int32_t(v[(n >> 1) - 1]) + v[n >> 1]) / 2);
+    }
+
+    /**
+     * Smooth a reading and publish it to the given bed.
+     * The raw value is the ADS1115 count << ADS1115_RAW_SHIFT, so the IIR output keeps
+     * a fractional bit and the thermistor table (thermistor_ads1115.h) is read at full resolution.
+     */
+    static void ads1115_publish(const uint8_t bed, const int16_t counts) {
+      const int32_t x = int32_t(_MAX(counts, int16_t(0))) << (ADS1115_RAW_SHIFT + 8);
+      int32_t &f = ads_filtered[bed];
+      const uint8_t k = thermalManager.ads1115_settings.iir_shift;
+      if (f && k) f += (x - f) >> k; else f = x;
+      thermalManager.temp_bed[bed].setraw(raw_adc_t((f + 0x80) >> 8));
+    }
+
+    // Result of the last ADS1115 job, filled in by the I2C queue
+    static volatile bool ads_busy; // = false
+    static I2CStatus ads_status;
+    static uint8_t ads_rx[2];
+
+    static void ads1115_job_done(const I2CJob &job) {
+      ads_status = job.status;
+      ads_rx[0] = job.rx[0];
+      ads_rx[1] = job.rx[1];
+      ads_busy = false;
+    }
+
+    static bool ads1115_request(const uint8_t * const tx, const uint8_t tx_len, const uint8_t rx_len) {
+      if (!i2c_async.enqueue(ADS1115_ADDRESS, tx, tx_len, rx_len, I2C_PRIO_NORMAL, ads1115_job_done)) return false;
+      ads_busy = true;
+      return true;
+    }
+
+    /**
+     * Non-blocking ADS1115 acquisition, called from Temperature::task().
+     *
+     * Each step queues at most one I2C job and the next step runs once it
+     * completes: start a single-shot conversion, poll the conversion-ready
+     * flag (or the ALERT/RDY pin), then fetch the result. Each channel is
+     * converted ads1115_settings.samples times in a row and the median is
+     * smoothed by ads1115_publish(). Channels are read round-robin, one sweep
+     * per ADS1115_WRITE_INTERVAL_MS, and every published reading is time-stamped
+     * so a stale bed zone can be detected with bedReadingStale(). A failed job
+     * skips to the next channel.
+     */
+    void Temperature::ads1115_task(const millis_t &ms) {
+      enum ADSState : uint8_t { ADS_START, ADS_STARTED, ADS_CONVERTING, ADS_POLLED, ADS_FETCHED };
+      static ADSState ads_state = ADS_START;
+      static uint8_t channel = 0, nsamples = 0;
+      static int16_t samples[ADS1115_SAMPLES_MAX];
+      static millis_t next_ms = 0, next_sweep_ms = 0, timeout_ms = 0;
+
+      if (ads_busy || PENDING(ms, next_ms)) return;
+
+      auto next_channel = [&]{
+        ads_state = ADS_START;
+        nsamples = 0;
+        if (++channel >= BED_COUNT) {
+          channel = 0;
+          next_ms = next_sweep_ms;
+        }
+      };
+
+      auto job_failed = [&]{
+        if (ads_status == I2C_DONE) return false;
+        SERIAL_ECHOLNPGM("ADS1115 I2C error on bed ", channel);
+        next_channel();
+        return true;
+      };
+
+      auto fetch = [&]{
+        const uint8_t tx = ADS1115_REG_CONVERSION;
+        if (ads1115_request(&tx, 1, 2)) ads_state = ADS_FETCHED;
+      };
+
+      auto keep_waiting = [&]{
+        if (ELAPSED(ms, timeout_ms)) {
+          SERIAL_ECHOLNPGM("ADS1115 conversion timeout on bed ", channel);
+          next_channel();
+        }
+        else {
+          next_ms = ms + 1;
+          ads_state = ADS_CONVERTING;
+        }
+      };
+
+      switch (ads_state) {
+        case ADS_START: {
+          if (channel == 0 && nsamples == 0) next_sweep_ms = ms + ADS1115_WRITE_INTERVAL_MS;
+          const uint16_t config = ADS1115_CONFIG | ADS1115_CFG_MUX_SINGLE(channel) | ADS1115_CFG_DR(ads1115_settings.data_rate);
+          const uint8_t tx[] = { ADS1115_REG_CONFIG, uint8_t(config >> 8), uint8_t(config & 0xFF) };
+          if (ads1115_request(tx, COUNT(tx), 0)) ads_state = ADS_STARTED;
+        } break;
+
+        case ADS_STARTED:   // Conversion started
+          if (job_failed()) break;
+          next_ms = ms + ads1115_conversion_ms(ads1115_settings.data_rate);
+          timeout_ms = ms + 4 * ads1115_conversion_ms(ads1115_settings.data_rate);
+          ads_state = ADS_CONVERTING;
+          break;
+
+        case ADS_CONVERTING:
+          #if ADS1115_HAS_RDY
+            if (!READ(ADS1115_RDY_PIN)) fetch(); else keep_waiting();
+          #else
+            {
+              const uint8_t tx = ADS1115_REG_CONFIG;
+              if (ads1115_request(&tx, 1, 2)) ads_state = ADS_POLLED;
+            }
+          #endif
+          break;
+
+        case ADS_POLLED:    // Config register read back
+          if (job_failed()) break;
+          if (ads_rx[0] & (ADS1115_CFG_OS >> 8)) fetch(); else keep_waiting();
+          break;
+
+        case ADS_FETCHED:   // Conversion result read
+          if (job_failed()) break;
+          samples[nsamples++] = int16_t((uint16_t(ads_rx[0]) << 8) | ads_rx[1]);
+          if (nsamples < _MIN(ads1115_settings.samples, ADS1115_SAMPLES_MAX)) {
+            ads_state = ADS_START;  // Another conversion of the same channel
+            break;
+          }
+          ads1115_publish(channel, ads1115_median(samples, nsamples));
+          bed_sample_ms[channel] = ms;
+          next_channel();
+          break;
       }
-    } 
+    }
   #endif
 
   #if PCF8574_BED_CONTROL
-    void Temperature::initPCF8574() { 
-      if (!bedPCF.begin(0x00)) {
-      SERIAL_ECHOLNPGM("Error initializing PCF8574");
-      }   
-    }
-   
-    // Guarda o último estado de PWM das beds
+    // Último estado escrito no PCF8574, um bit por cama
     static uint8_t bed_pcf_state = 0;
 
-    // Timestamp da última escrita no PCF8574
-    static millis_t last_pcf_write_ms = 0;
+    // Force a write on the next PWM update (after init or an I2C error)
+    static bool bed_pcf_dirty = true;
+
+    // A write is waiting in the I2C queue
+    static volatile bool bed_pcf_pending; // = false
 
-    // Chama bedPCF.write8(state) no máximo uma vez a cada PCF8574_WRITE_INTERVAL_MS
+    void Temperature::initPCF8574() {
+      const uint8_t off = 0x00;
+      if (i2c_async.run(PCF8574_ADDRESS, &off, 1) != I2C_DONE)
+        SERIAL_ECHOLNPGM("Error initializing PCF8574");
+    }
+
+    static void bed_pcf_write_done(const I2CJob &job) {
+      if (job.ok())
+        bed_pcf_state = uint8_t(job.tag);
+      else {
+        SERIAL_ECHOLNPGM("!! PCF8574 write error: ", job.status);
+        bed_pcf_dirty = true;
+      }
+      bed_pcf_pending = false;
+    }
+
+    // Queue a write of the bed outputs to the PCF8574, ahead of sensor reads
     void Temperature::write_bed_PCF8574_state(const uint8_t state) {
-      const millis_t now = millis();
-      if (now - last_pcf_write_ms < PCF8574_WRITE_INTERVAL_MS) return;
-      last_pcf_write_ms = now;
-
-      #if SERIAL_MULTI_BEDS
-        // Exibe cada bit das camas 0..3
-        SERIAL_ECHOPGM("PCF Beds: [");
-        for (uint8_t b = 0; b < 4; ++b) {
-          SERIAL_ECHO((state >> b) & 1);
-          if (b < 3) SERIAL_ECHOPGM(",");
+      if (!i2c_async.write(PCF8574_ADDRESS, &state, 1, I2C_PRIO_HIGH, bed_pcf_write_done, state)) {
+        bed_pcf_dirty = true;
+        return;
+      }
+      bed_pcf_pending = true;
+      bed_pcf_dirty = false;
+    }
+
+    // Switch all bed zones off right away, bypassing the queue. Queued writes are dropped.
+    static void bed_pcf_off_now() {
+      const uint8_t off = 0x00;
+      bed_pcf_pending = false;
+      if (i2c_async.write_now(PCF8574_ADDRESS, &off, 1))
+        bed_pcf_state = off;
+      else
+        bed_pcf_dirty = true;
+    }
+    /**
+     * Time-proportioning PWM for the expander-driven bed zones, called from the main loop.
+     *
+     * In every PCF8574_PWM_WINDOW_MS window each zone is switched on for exactly
+     * its duty share of the window. The on-intervals are laid end to end around
+     * the window, so no more than ceil(total duty) zones are on at once and the
+     * PSU peak load and inrush stay low. The expander is only written when an
+     * output changes. A zone whose power drops to 0 is switched off at once.
+     */
+    void Temperature::bed_pcf_pwm_task(const millis_t &ms) {
+      static millis_t window_start_ms;
+      static bool window_started = false;
+      static uint16_t on_start_ms[BED_COUNT], on_len_ms[BED_COUNT];
+
+      if (!window_started || ms - window_start_ms >= PCF8574_PWM_WINDOW_MS) {
+        window_started = true;
+        window_start_ms = ms;
+        // Place each zone's on-interval right after the previous zone's
+        uint32_t offset = 0;
+        for (uint8_t b = 0; b < BED_COUNT; ++b) {
+          const uint32_t len = uint32_t(PCF8574_PWM_WINDOW_MS) * temp_bed[b].soft_pwm_amount / (MAX_BED_POWER >> 1);
+          on_len_ms[b] = _MIN(len, uint32_t(PCF8574_PWM_WINDOW_MS));
+          on_start_ms[b] = offset % (PCF8574_PWM_WINDOW_MS);
+          offset += on_len_ms[b];
         }
-        SERIAL_ECHOLNPGM("] ");           
-      #endif
+      }
 
-      Wire.beginTransmission(PCF8574_ADDRESS);
-      Wire.write(state);
-      const uint8_t err = Wire.endTransmission();
-      if (err) {
-        SERIAL_ECHOPGM("!! PCF8574 write error: ");
-        SERIAL_ECHOLN(err);
+      const uint16_t t = ms - window_start_ms;
+      uint8_t state = 0;
+      for (uint8_t b = 0; b < BED_COUNT; ++b) {
+        const uint16_t phase = (t + (PCF8574_PWM_WINDOW_MS) - on_start_ms[b]) % (PCF8574_PWM_WINDOW_MS);
+        if (temp_bed[b].soft_pwm_amount && phase < on_len_ms[b])
+          state |= _BV(BED0_PCF_BIT + b);
       }
+
+      if (!bed_pcf_pending && (bed_pcf_dirty || state != bed_pcf_state)) write_bed_PCF8574_state(state);
     }
   #endif
 #endif
@@ -590,6 +756,11 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
     #if DISABLED(PIDTEMPBED)
       millis_t   Temperature::next_bed_check_ms[BED_COUNT];
     #endif
+    #if ENABLED(BED_ZONE_COUPLING)
+      float      Temperature::bed_coupling[BED_COUNT][BED_COUNT];   // Initialized by settings.load()
+      float      Temperature::bed_zone_gain[BED_COUNT];
+      float      Temperature::bed_decoupling[BED_COUNT][BED_COUNT];
+    #endif
   #else //Single Bed Fallback
     bed_info_t Temperature::temp_bed; // = { 0 }
     // Init min and max temp with extreme values to prevent false errors during startup
@@ -748,8 +919,18 @@ volatile bool Temperature::raw_temps_ready = false;
     PID_t tune_pid = { 0, 0, 0 };
     celsius_float_t maxT = 0, minT = 10000;
 
-    const bool isbed = (heater_id == H_BED0),
-           ischamber = (heater_id == H_CHAMBER);
+    #if HAS_MULTI_BEDS
+      // Each bed zone is tuned on its own, with the other zones switched off
+      const bool isbed = WITHIN(heater_id, H_BED0 - (BED_COUNT - 1), H_BED0);
+      const uint8_t tune_bed = isbed ? H_BED0 - heater_id : 0;
+      #define TUNE_BED temp_bed[tune_bed]
+      #define TUNE_BED_INDEX tune_bed
+    #else
+      const bool isbed = (heater_id == H_BED0);
+      #define TUNE_BED temp_bed
+      #define TUNE_BED_INDEX
+    #endif
+    const bool ischamber = (heater_id == H_CHAMBER);
 
     #if ENABLED(PIDTEMPCHAMBER)
       #define C_TERN(T,A,B) ((T) ? (A) : (B))
@@ -762,7 +943,7 @@ volatile bool Temperature::raw_temps_ready = false;
       #define B_TERN(T,A,B) (B)
     #endif
     #define GHV(C,B,H) C_TERN(ischamber, C, B_TERN(isbed, B, H))
-    #define SHV(V) C_TERN(ischamber, temp_chamber.soft_pwm_amount = V, B_TERN(isbed, temp_bed.soft_pwm_amount = V, temp_hotend[heater_id].soft_pwm_amount = V))
+    #define SHV(V) C_TERN(ischamber, temp_chamber.soft_pwm_amount = V, B_TERN(isbed, TUNE_BED.soft_pwm_amount = V, temp_hotend[heater_id].soft_pwm_amount = V))
     #define ONHEATINGSTART() C_TERN(ischamber, printerEventLEDs.onChamberHeatingStart(), B_TERN(isbed, printerEventLEDs.onBedHeatingStart(), printerEventLEDs.onHotendHeatingStart()))
     #define ONHEATING(S,C,T) C_TERN(ischamber, printerEventLEDs.onChamberHeating(S,C,T), B_TERN(isbed, printerEventLEDs.onBedHeating(S,C,T), printerEventLEDs.onHotendHeating(S,C,T)))
 
@@ -808,11 +989,17 @@ volatile bool Temperature::raw_temps_ready = false;
     disable_all_heaters();
     TERN_(AUTO_POWER_CONTROL, powerManager.power_on());
 
+    #if ENABLED(BED_ZONE_COUPLING)
+      // Starting temperatures for identifying how the tuned zone heats the others
+      celsius_float_t zone_start_temp[BED_COUNT];
+      for (uint8_t b = 0; b < BED_COUNT; ++b) zone_start_temp[b] = degBed(b);
+    #endif
+
     long bias = GHV(MAX_CHAMBER_POWER, MAX_BED_POWER, PID_MAX) >> 1, d = bias;
     SHV(bias);
 
     #if ENABLED(PRINTER_EVENT_LEDS)
-      const celsius_float_t start_temp = GHV(degChamber(), degBed(), degHotend(heater_id));
+      const celsius_float_t start_temp = GHV(degChamber(), degBed(TUNE_BED_INDEX), degHotend(heater_id));
       LEDColor color = ONHEATINGSTART();
     #endif
 
@@ -826,10 +1013,15 @@ volatile bool Temperature::raw_temps_ready = false;
 
       const millis_t ms = millis();
 
+      // Bed zones are read and driven over I2C from the main loop, not the ISR
+      TERN_(I2C_ASYNC_QUEUE, i2c_async.task());
+      TERN_(ADS1115_BED_READING, ads1115_task(ms));
+      TERN_(PCF8574_BED_CONTROL, bed_pcf_pwm_task(ms));
+
       if (updateTemperaturesIfReady()) { // temp sample ready
 
         // Get the current temperature and constrain it
-        current_temp = GHV(degChamber(), degBed(), degHotend(heater_id));
+        current_temp = GHV(degChamber(), degBed(TUNE_BED_INDEX), degHotend(heater_id));
         NOLESS(maxT, current_temp);
         NOMORE(minT, current_temp);
 
@@ -943,6 +1135,9 @@ volatile bool Temperature::raw_temps_ready = false;
 
         #if EITHER(PIDTEMPBED, PIDTEMPCHAMBER)
           FSTR_P const estring = GHV(F("chamber"), F("bed"), FPSTR(NUL_STR));
+          #if BOTH(HAS_MULTI_BEDS, PIDTEMPBED)
+            if (isbed) SERIAL_ECHOLNPGM("; Bed zone ", tune_bed, " (M304 B", tune_bed, ")");
+          #endif
           say_default_(); SERIAL_ECHOF(estring); SERIAL_ECHOLNPGM("Kp ", tune_pid.Kp);
           say_default_(); SERIAL_ECHOF(estring); SERIAL_ECHOLNPGM("Ki ", tune_pid.Ki);
           say_default_(); SERIAL_ECHOF(estring); SERIAL_ECHOLNPGM("Kd ", tune_pid.Kd);
@@ -964,10 +1159,10 @@ volatile bool Temperature::raw_temps_ready = false;
         };
 
         #if ENABLED(PIDTEMPBED)
-          auto _set_bed_pid = [](const PID_t &in_pid) {
-            temp_bed.pid.Kp = in_pid.Kp;
-            temp_bed.pid.Ki = scalePID_i(in_pid.Ki);
-            temp_bed.pid.Kd = scalePID_d(in_pid.Kd);
+          auto _set_bed_pid = [&](const PID_t &in_pid) {
+            TUNE_BED.pid.Kp = in_pid.Kp;
+            TUNE_BED.pid.Ki = scalePID_i(in_pid.Ki);
+            TUNE_BED.pid.Kd = scalePID_d(in_pid.Kd);
           };
         #endif
 
@@ -983,6 +1178,34 @@ volatile bool Temperature::raw_temps_ready = false;
         if (set_result)
           GHV(_set_chamber_pid(tune_pid), _set_bed_pid(tune_pid), _set_hotend_pid(heater_id, tune_pid));
 
+        #if ENABLED(BED_ZONE_COUPLING)
+          /**
+           * Coupling column for the tuned zone: rise of each other zone per degree of own rise.
+           * The self gain is the own rise scaled to full power from the mean power of the last
+           * cycles. Both are taken when autotune ends, before the plate has settled, so they
+           * are estimates. Tune each zone from a cold plate and refine them with M307 if needed.
+           */
+          if (isbed) {
+            const float own_rise = degBed(tune_bed) - zone_start_temp[tune_bed];
+            if (own_rise > 5) {
+              const float gain = own_rise * MAX_BED_POWER / bias;
+              SERIAL_ECHOPGM("Bed zone gain B", tune_bed, ": ");
+              SERIAL_ECHO_F(gain, 1);
+              SERIAL_EOL();
+              if (set_result) bed_zone_gain[tune_bed] = gain;
+              SERIAL_ECHOPGM("Bed zone coupling B", tune_bed, ":");
+              for (uint8_t j = 0; j < BED_COUNT; ++j) {
+                if (j == tune_bed) continue;
+                const float g = constrain((degBed(j) - zone_start_temp[j]) / own_rise, 0, 0.9f);
+                SERIAL_ECHOPGM(" B", j, ":"); SERIAL_ECHO_F(g, 3);
+                if (set_result) bed_coupling[j][tune_bed] = g;
+              }
+              SERIAL_EOL();
+              if (set_result) update_bed_decoupling();
+            }
+          }
+        #endif
+
         TERN_(PRINTER_EVENT_LEDS, printerEventLEDs.onPidTuningDone(color));
 
         TERN_(EXTENSIBLE_UI, ExtUI::onPidTuning(ExtUI::result_t::PID_DONE));
@@ -1672,12 +1895,36 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
 
 #if ENABLED(PIDTEMPBED)
 
-  float Temperature::get_pid_output_bed() {
-    static PIDRunner<bed_info_t, MIN_BED_POWER, MAX_BED_POWER> bed_pid(temp_bed);
-    const float pid_output = bed_pid.get_pid_output();
-    TERN_(PID_BED_DEBUG, bed_pid.debug(temp_bed.celsius, pid_output, F("(Bed)")));
-    return pid_output;
-  }
+  #if HAS_MULTI_BEDS
+
+    float Temperature::get_pid_output_bed(const uint8_t bed) {
+      typedef PIDRunner<bed_info_t, MIN_BED_POWER, MAX_BED_POWER> PIDRunnerBed;
+
+      static PIDRunnerBed bed_pid[BED_COUNT] = {
+        temp_bed[0], temp_bed[1]
+        #if BED_COUNT > 2
+          , temp_bed[2]
+        #endif
+        #if BED_COUNT > 3
+          , temp_bed[3]
+        #endif
+      };
+
+      const float pid_output = bed_pid[bed].get_pid_output();
+      TERN_(PID_BED_DEBUG, bed_pid[bed].debug(temp_bed[bed].celsius, pid_output, F("(Bed)"), bed));
+      return pid_output;
+    }
+
+  #else
+
+    float Temperature::get_pid_output_bed() {
+      static PIDRunner<bed_info_t, MIN_BED_POWER, MAX_BED_POWER> bed_pid(temp_bed);
+      const float pid_output = bed_pid.get_pid_output();
+      TERN_(PID_BED_DEBUG, bed_pid.debug(temp_bed.celsius, pid_output, F("(Bed)")));
+      return pid_output;
+    }
+
+  #endif
 
 #endif // PIDTEMPBED
 
@@ -1730,28 +1977,121 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
 /*#################################### TCC LUCAS ####################################*/
 #if HAS_HEATED_BED
   #if HAS_MULTI_BEDS
-    void Temperature::manage_heated_bed(const uint8_t bed, const millis_t &ms) {                    
-                        
-      if (PENDING(ms, next_bed_check_ms[bed])) {            
-        next_bed_check_ms[bed] = ms + BED_CHECK_INTERVAL;
-      }                 
-
-      if (WITHIN(temp_bed[bed].celsius, BED_MINTEMP, BED_MAXTEMP)) {          
-          temp_bed[bed].soft_pwm_amount =
-            temp_bed[bed].is_below_target() ? MAX_BED_POWER >> 1 : 0;         
+    void Temperature::manage_heated_bed(const uint8_t bed, const millis_t &ms) {
+
+      #if DISABLED(PIDTEMPBED)
+        if (PENDING(ms, next_bed_check_ms[bed])) {
+          next_bed_check_ms[bed] = ms + BED_CHECK_INTERVAL;
+        }
+      #endif
+
+      if (WITHIN(temp_bed[bed].celsius, BED_MINTEMP, BED_MAXTEMP)
+        && TERN1(ADS1115_BED_READING, !bedReadingStale(bed, ms))
+      ) {
+        // Each zone runs its own PID loop, or bang-bang without PIDTEMPBED
+        temp_bed[bed].soft_pwm_amount = TERN(PIDTEMPBED,
+          (int)get_pid_output_bed(bed) >> 1,
+          temp_bed[bed].is_below_target() ? MAX_BED_POWER >> 1 : 0
+        );
       }
       else {
-        temp_bed[bed].soft_pwm_amount = 0;          
-      }       
+        temp_bed[bed].soft_pwm_amount = 0;
+      }
     }
 
     void Temperature::manage_all_heated_beds(const millis_t &ms) {
-      for (uint8_t b = 0; b < BED_COUNT; ++b){
-        manage_heated_bed(b, ms);      
+      for (uint8_t b = 0; b < BED_COUNT; ++b)
+        manage_heated_bed(b, ms);
 
-      }           
+      TERN_(BED_ZONE_COUPLING, decouple_bed_power());
     }
 
+    #if ENABLED(BED_ZONE_COUPLING)
+
+      void Temperature::reset_bed_coupling() {
+        for (uint8_t j = 0; j < BED_COUNT; ++j) {
+          for (uint8_t n = 0; n < BED_COUNT; ++n)
+            bed_coupling[j][n] = (j == n) ? 1.0f : 0.0f;
+          bed_zone_gain[j] = 1.0f;
+        }
+        update_bed_decoupling();
+      }
+
+      /**
+       * Invert the coupling matrix (Gauss-Jordan with partial pivoting) to get
+       * the static decoupler applied to the zone PID outputs. With a singular
+       * matrix the decoupler falls back to the identity.
+       *
+       * The coupling gains are ratios of temperature rise, but the decoupler
+       * mixes power. Zone j warms g[j] per unit of its own power and c[j][n] * g[n]
+       * per unit of zone n power, so row j is scaled by its own gain: the inverse
+       * of c[j][n] * g[n] / g[j] leaves each zone with only its own plant.
+       */
+      void Temperature::update_bed_decoupling() {
+        float a[BED_COUNT][BED_COUNT], (&inv)[BED_COUNT][BED_COUNT] = bed_decoupling;
+        for (uint8_t j = 0; j < BED_COUNT; ++j)
+          for (uint8_t n = 0; n < BED_COUNT; ++n) {
+            a[j][n] = (j == n) ? 1.0f : bed_coupling[j][n] * bed_zone_gain[n] / bed_zone_gain[j];
+            inv[j][n] = (j == n) ? 1.0f : 0.0f;
+          }
+
+        for (uint8_t c = 0; c < BED_COUNT; ++c) {
+          uint8_t p = c;
+          for (uint8_t r = c + 1; r < BED_COUNT; ++r)
+            if (ABS(a[r][c]) > ABS(a[p][c])) p = r;
+
+          if (ABS(a[p][c]) < 1e-4f) {
+            SERIAL_ECHOLNPGM("Bed zone coupling matrix is singular. Decoupling disabled.");
+            for (uint8_t j = 0; j < BED_COUNT; ++j)
+              for (uint8_t n = 0; n < BED_COUNT; ++n)
+                inv[j][n] = (j == n) ? 1.0f : 0.0f;
+            return;
+          }
+
+          if (p != c) for (uint8_t n = 0; n < BED_COUNT; ++n) {
+            float t = a[p][n]; a[p][n] = a[c][n]; a[c][n] = t;
+            t = inv[p][n]; inv[p][n] = inv[c][n]; inv[c][n] = t;
+          }
+
+          const float d = 1.0f / a[c][c];
+          for (uint8_t n = 0; n < BED_COUNT; ++n) { a[c][n] *= d; inv[c][n] *= d; }
+
+          for (uint8_t r = 0; r < BED_COUNT; ++r) {
+            if (r == c) continue;
+            const float f = a[r][c];
+            for (uint8_t n = 0; n < BED_COUNT; ++n) {
+              a[r][n] -= f * a[c][n];
+              inv[r][n] -= f * inv[c][n];
+            }
+          }
+        }
+      }
+
+      /**
+       * Feed-forward decoupling of the bed zones. Each zone's power is mixed
+       * from all zone controllers so the heat a zone receives from its
+       * neighbours through the plate is taken off its own heater. Every zone
+       * loop then sees only its own plant, as it did during autotune. Zones
+       * that are off, out of range or stale are left off.
+       */
+      void Temperature::decouple_bed_power() {
+        float u[BED_COUNT];
+        bool active[BED_COUNT];
+        for (uint8_t b = 0; b < BED_COUNT; ++b) {
+          u[b] = temp_bed[b].soft_pwm_amount;
+          active[b] = temp_bed[b].target && WITHIN(temp_bed[b].celsius, BED_MINTEMP, BED_MAXTEMP)
+                      && TERN1(ADS1115_BED_READING, !bedReadingStale(b));
+        }
+        for (uint8_t b = 0; b < BED_COUNT; ++b) {
+          if (!active[b]) continue;
+          float v = 0;
+          for (uint8_t n = 0; n < BED_COUNT; ++n) v += bed_decoupling[b][n] * u[n];
+          temp_bed[b].soft_pwm_amount = constrain(v, 0, MAX_BED_POWER >> 1);
+        }
+      }
+
+    #endif // BED_ZONE_COUPLING
+
   #else //Single Bed Fallback
 
     void Temperature::manage_heated_bed(const millis_t &ms) {
@@ -2047,6 +2387,10 @@ void Temperature::task() {
     }
   #endif
 
+  // Advance the I2C bed zones: one ADS1115 acquisition step and the expander PWM
+  TERN_(ADS1115_BED_READING, ads1115_task(millis()));
+  TERN_(PCF8574_BED_CONTROL, bed_pcf_pwm_task(millis()));
+
   if (!updateTemperaturesIfReady()) return; // Will also reset the watchdog if temperatures are ready
 
   #if DISABLED(IGNORE_THERMOCOUPLE_ERRORS)
@@ -2091,7 +2435,6 @@ void Temperature::task() {
   #if HAS_HEATED_BED
       #if HAS_MULTI_BEDS
         manage_all_heated_beds(ms);
-        write_bed_PCF8574_state(bed_pcf_state);
       #else //Single Bed Fallback
         manage_heated_bed(ms);
       #endif 
@@ -2399,11 +2742,6 @@ void Temperature::task() {
       UNUSED(raw);
       return 0;
     #endif
-
-    #if SERIAL_MULTI_BEDS      
-      SERIAL_ECHOPGM("atcb raw10_ADS1115: "); SERIAL_ECHOLN(raw);           
-    #endif
-
   }
 #endif // HAS_HEATED_BED
 
@@ -2529,31 +2867,9 @@ void Temperature::updateTemperaturesFromRawValues() {
   #if HAS_MULTI_BEDS    
 
     // Para cada cama, converte o raw de 10 bits em °C
-    for (uint8_t b = 0; b < BED_COUNT; ++b) {
+    for (uint8_t b = 0; b < BED_COUNT; ++b)
       temp_bed[b].celsius = analog_to_celsius_bed(temp_bed[b].getraw());
-      float c = temp_bed[b].celsius;        
-
-      #if SERIAL_MULTI_BEDS        
-        SERIAL_ECHO(c);
-        SERIAL_ECHOPGM(", ");               
-      #endif          
-    }   
-   
-    #if SERIAL_MULTI_BEDS
-    //float l = analog_to_celsius_bed(999999);
-    //float m = analog_to_celsius_bed(500000);
-   // float n = analog_to_celsius_bed(100000);
-    //float o = analog_to_celsius_bed(31000);
-   // SERIAL_ECHO(l);
-   // SERIAL_ECHOPGM(", "); 
-   // SERIAL_ECHO(m);
-  //  SERIAL_ECHOPGM(", "); 
-   // SERIAL_ECHO(n);
-   // SERIAL_ECHOPGM(", "); 
-   // SERIAL_ECHO(o);      
-    SERIAL_ECHOLN(" ");        
-    #endif
-      
+
   #elif HAS_HEATED_BED
       // Single-bed
       temp_bed.celsius = analog_to_celsius_bed(temp_bed.getraw());
@@ -2659,10 +2975,6 @@ void Temperature::init() {
     pes_e_position = 0;
   #endif
 
-  #if ADS1115_BED_READING || PCF8574_BED_CONTROL
-    initWireI2C();
-  #endif
-
   #if ADS1115_BED_READING
     initADS1115();
   #endif
@@ -3168,7 +3480,7 @@ void Temperature::disable_all_heaters() {
       setAllTargetBed(0);
       for (uint8_t b = 0; b < BED_COUNT; ++b)
         temp_bed[b].soft_pwm_amount = 0;
-      bedPCF.write8(0); 
+      bed_pcf_off_now();
     #else
       setTargetBed(0);
       temp_bed.soft_pwm_amount = 0;
@@ -3473,14 +3785,8 @@ void Temperature::update_raw_temperatures() {
   TERN_(HAS_TEMP_ADC_7,       temp_hotend[7].update());
 
   /*#################################### TCC LUCAS ####################################*/
-  #if ADS1115_BED_READING
-    static millis_t last_ads_read_ms = 0;
-    const millis_t now = millis();
-    if (now - last_ads_read_ms >= ADS1115_WRITE_INTERVAL_MS) {
-      last_ads_read_ms = now;
-      read_bed_temperatures_ADS1115(); // popula temp_bed[b].raw internamente
-    }
-  #elif HAS_TEMP_ADC_BED
+  // ADS1115 bed readings are acquired by ads1115_task(), outside of the ISR
+  #if HAS_TEMP_ADC_BED && !ADS1115_BED_READING
     temp_bed.update();
   #endif
 
@@ -3622,9 +3928,10 @@ void Temperature::isr() {
 
   /*#################################### TCC LUCAS ####################################*/
 
-  #if HAS_HEATED_BED    
-    static SoftPWM soft_pwm_bed[BED_COUNT];
-  #endif  
+  // PCF8574 bed zones are modulated by bed_pcf_pwm_task(), outside of the ISR
+  #if HAS_HEATED_BED && !PCF8574_BED_CONTROL
+    static SoftPWM soft_pwm_bed;
+  #endif
 
   #if HAS_HEATED_CHAMBER
     static SoftPWM soft_pwm_chamber;
@@ -3662,20 +3969,8 @@ void Temperature::isr() {
       #endif
 
       /*#################################### TCC LUCAS ####################################*/
-      #if HAS_HEATED_BED
-        #if PCF8574_BED_CONTROL
-          // Monta o byte para o PCF8574, um bit por cama
-          uint8_t state = 0;
-          for (uint8_t b = 0; b < BED_COUNT; ++b) {
-          const uint8_t mask = 1 << b;
-          if ( soft_pwm_bed[b].add(mask, temp_bed[b].soft_pwm_amount) )
-            state |= _BV(BED0_PCF_BIT + b);
-          }
-          // Só atualiza a variável global — sem I²C aqui!
-          bed_pcf_state = state;
-        #else //Single Bed Fallback
-          _PWM_MOD(BED, soft_pwm_bed, temp_bed);
-        #endif
+      #if HAS_HEATED_BED && !PCF8574_BED_CONTROL
+        _PWM_MOD(BED, soft_pwm_bed, temp_bed);
       #endif
 
       #if HAS_HEATED_CHAMBER
@@ -3805,7 +4100,7 @@ void Temperature::isr() {
         REPEAT(HOTENDS, _SLOW_PWM_E);
       #endif
 
-      #if HAS_HEATED_BED
+      #if HAS_HEATED_BED && !PCF8574_BED_CONTROL
         _SLOW_PWM(BED, soft_pwm_bed, temp_bed);
       #endif
 
@@ -3824,7 +4119,7 @@ void Temperature::isr() {
       REPEAT(HOTENDS, _PWM_OFF_E);
     #endif
 
-    #if HAS_HEATED_BED
+    #if HAS_HEATED_BED && !PCF8574_BED_CONTROL
       _PWM_OFF(BED, soft_pwm_bed);
     #endif
 
@@ -3913,7 +4208,9 @@ void Temperature::isr() {
       #if HAS_HOTEND
         HOTEND_LOOP() soft_pwm_hotend[e].dec();
       #endif
-      TERN_(HAS_HEATED_BED, soft_pwm_bed.dec());
+      #if HAS_HEATED_BED && !PCF8574_BED_CONTROL
+        soft_pwm_bed.dec();
+      #endif
       TERN_(HAS_HEATED_CHAMBER, soft_pwm_chamber.dec());
       TERN_(HAS_COOLER, soft_pwm_cooler.dec());
     }
@@ -4585,6 +4882,7 @@ void Temperature::isr() {
         bool click_to_cancel     /*=false*/) {
         // Chama wait_for_bed para cada mesa; só retorna false se alguma falhar
         for (uint8_t b = 0; b < BED_COUNT; ++b) {
+          if (TERN0(BED_ZONE_FOOTPRINT, !bedfootprint.zone_active(b))) continue; // Zone not under the print
           SERIAL_ECHOPGM("Waiting for bed ");
           SERIAL_ECHO(b);
           SERIAL_ECHOLNPGM(" to reach target...");
@@ -47,15 +47,7 @@
 
 /*#################################### TCC LUCAS ####################################*/
 #if ADS1115_BED_READING || PCF8574_BED_CONTROL
-  #include <Wire.h>
-#endif
-
-#if ADS1115_BED_READING
-  #include <Adafruit_ADS1X15.h>    
-#endif
-
-#if PCF8574_BED_CONTROL   
-  #include <PCF8574.h>
+  #include "../HAL/shared/i2c_async.h"
 #endif
 
 #define HOTEND_INDEX TERN(HAS_MULTI_HOTEND, e, 0)
@@ -568,27 +560,28 @@ class Temperature {
       #if HAS_MULTI_BEDS
         static raw_adc_t mintemp_raw_BED[BED_COUNT], maxtemp_raw_BED[BED_COUNT];
       #endif
+
+      #if ENABLED(BED_ZONE_COUPLING)
+        static float bed_decoupling[BED_COUNT][BED_COUNT];  // Inverse of bed_coupling
+        static void decouple_bed_power();
+      #endif
     #endif
     
-    #if ADS1115_BED_READING || PCF8574_BED_CONTROL
-      static void initWireI2C();
-    #endif
-
     #if ADS1115_BED_READING
-       static uint16_t raw_ads[BED_COUNT];
-      /** ADS1115 for multi-bed temperature readings */
-      static Adafruit_ADS1115 bedADS;
       /** Initialize ADS1115 hardware */
-      static void initADS1115();      
-      static void read_bed_temperatures_ADS1115();
+      static void initADS1115();
+      /** Non-blocking round-robin acquisition, at most one queued I2C job per call */
+      static void ads1115_task(const millis_t &ms);
+      /** Time of the last reading published for each bed */
+      static millis_t bed_sample_ms[BED_COUNT];
     #endif
 
     #if PCF8574_BED_CONTROL
-      /** PCF8574 for multi-bed heater outputs */
-      static PCF8574 bedPCF;
       /** Initialize PCF8574 expander */
       static void initPCF8574();
       static void write_bed_PCF8574_state(const uint8_t state);
+      /** Phase-staggered slow PWM of the bed zones, writing only on edges */
+      static void bed_pcf_pwm_task(const millis_t &ms);
     #endif
 
     #if HAS_HEATED_CHAMBER
@@ -874,6 +867,27 @@ class Temperature {
         static celsius_float_t degBed(const uint8_t bed) { return temp_bed[bed].celsius; }
         static celsius_t wholeDegBed(const uint8_t bed) { return static_cast<celsius_t>(degBed(bed) + 0.5f); }
         static celsius_t degTargetBed(const uint8_t bed) { return temp_bed[bed].target; }
+        #if ADS1115_BED_READING
+          // True if the bed has had no fresh ADS1115 reading for ADS1115_STALE_MS
+          static bool bedReadingStale(const uint8_t bed, const millis_t &ms=millis()) {
+            return ELAPSED(ms, bed_sample_ms[bed] + (ADS1115_STALE_MS));
+          }
+
+          #define ADS1115_RAW_SHIFT   1   // Bed raw values are ADS1115 counts << 1
+          #define ADS1115_SAMPLES_MAX 7
+          typedef struct {
+            uint8_t data_rate;        // Conversion rate index, 0 (8SPS) to 7 (860SPS)
+            uint8_t samples;          // Conversions per reading, combined by median
+            uint8_t iir_shift;        // Weight of a new reading is 1/2^iir_shift. 0 = no smoothing.
+          } ads1115_settings_t;
+          static ads1115_settings_t ads1115_settings;
+          static void reset_ads1115_settings();
+          static uint16_t ads1115_sps(const uint8_t rate);
+          /** Restart the filters, e.g., after the settings change */
+          static void ads1115_reset_filters();
+          /** Time for one full sweep of the bed channels with the given settings */
+          static millis_t ads1115_sweep_ms(const ads1115_settings_t &s);
+        #endif
        
         static bool isHeatingBed(const uint8_t bed) { return temp_bed[bed].target > temp_bed[bed].celsius; }
         static bool isAnyHeatingBed() {
@@ -938,6 +952,15 @@ class Temperature {
         static void manage_heated_bed(const uint8_t bed,const millis_t &ms);
         static void manage_all_heated_beds(const millis_t &ms);
 
+        #if ENABLED(BED_ZONE_COUPLING)
+          // Thermal coupling gains: bed_coupling[j][n] is the rise of zone j per degree of rise of zone n
+          static float bed_coupling[BED_COUNT][BED_COUNT];
+          // Self gains: the rise of each zone at full power, to compare the zones' power
+          static float bed_zone_gain[BED_COUNT];
+          static void reset_bed_coupling();
+          static void update_bed_decoupling();
+        #endif
+
       #else //single bed Fallback
 
         #if ENABLED(SHOW_TEMP_ADC_VALUES)
@@ -1202,8 +1225,12 @@ class Temperature {
     #if HAS_HOTEND
       static float get_pid_output_hotend(const uint8_t e);
     #endif
-    #if ENABLED(PIDTEMPBED) // DISABLED FOR MULTI-BEDS
-      static float get_pid_output_bed();
+    #if ENABLED(PIDTEMPBED)
+      #if HAS_MULTI_BEDS
+        static float get_pid_output_bed(const uint8_t bed);
+      #else
+        static float get_pid_output_bed();
+      #endif
     #endif
     #if ENABLED(PIDTEMPCHAMBER)
       static float get_pid_output_chamber();
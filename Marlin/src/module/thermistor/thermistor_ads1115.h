@@ -0,0 +1,193 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright c 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright c 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * at your option any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Bed thermistor table in ADS1115 units, for ADS1115_BED_READING
+ *
+ * Values are ADS1115 counts << ADS1115_RAW_SHIFT, so a filtered reading keeps
+ * its full 16-bit resolution. 2°C steps keep the linear interpolation error
+ * well under the sensor tolerance.
+ *
+ * Generated for the thermistor 133 circuit: R25 = 100 kOhm, beta25 = 4092 K,
+ * 4.7 kOhm resistor to ground, thermistor to 3.3V (26430 counts at GAIN_ONE):
+ *
+ *   value = 52860 * 4700 / (R(T) + 4700)
+ */
+constexpr temp_entry_t temptable_ads1115[] PROGMEM = {
+  {   397,  -10 },
+  {   446,   -8 },
+  {   501,   -6 },
+  {   560,   -4 },
+  {   626,   -2 },
+  {   698,    0 },
+  {   777,    2 },
+  {   864,    4 },
+  {   958,    6 },
+  {  1062,    8 },
+  {  1174,   10 },
+  {  1296,   12 },
+  {  1429,   14 },
+  {  1572,   16 },
+  {  1728,   18 },
+  {  1895,   20 },
+  {  2076,   22 },
+  {  2270,   24 },
+  {  2479,   26 },
+  {  2703,   28 },
+  {  2942,   30 },
+  {  3198,   32 },
+  {  3470,   34 },
+  {  3761,   36 },
+  {  4069,   38 },
+  {  4396,   40 },
+  {  4742,   42 },
+  {  5107,   44 },
+  {  5493,   46 },
+  {  5898,   48 },
+  {  6324,   50 },
+  {  6771,   52 },
+  {  7238,   54 },
+  {  7726,   56 },
+  {  8235,   58 },
+  {  8764,   60 },
+  {  9313,   62 },
+  {  9882,   64 },
+  { 10470,   66 },
+  { 11076,   68 },
+  { 11701,   70 },
+  { 12342,   72 },
+  { 13000,   74 },
+  { 13674,   76 },
+  { 14361,   78 },
+  { 15062,   80 },
+  { 15774,   82 },
+  { 16497,   84 },
+  { 17230,   86 },
+  { 17971,   88 },
+  { 18718,   90 },
+  { 19471,   92 },
+  { 20227,   94 },
+  { 20986,   96 },
+  { 21747,   98 },
+  { 22507,  100 },
+  { 23266,  102 },
+  { 24021,  104 },
+  { 24773,  106 },
+  { 25520,  108 },
+  { 26260,  110 },
+  { 26993,  112 },
+  { 27717,  114 },
+  { 28432,  116 },
+  { 29137,  118 },
+  { 29831,  120 },
+  { 30513,  122 },
+  { 31183,  124 },
+  { 31840,  126 },
+  { 32484,  128 },
+  { 33113,  130 },
+  { 33729,  132 },
+  { 34331,  134 },
+  { 34917,  136 },
+  { 35489,  138 },
+  { 36047,  140 },
+  { 36589,  142 },
+  { 37116,  144 },
+  { 37629,  146 },
+  { 38126,  148 },
+  { 38609,  150 },
+  { 39078,  152 },
+  { 39532,  154 },
+  { 39972,  156 },
+  { 40398,  158 },
+  { 40811,  160 },
+  { 41210,  162 },
+  { 41596,  164 },
+  { 41969,  166 },
+  { 42330,  168 },
+  { 42679,  170 },
+  { 43015,  172 },
+  { 43340,  174 },
+  { 43654,  176 },
+  { 43957,  178 },
+  { 44250,  180 },
+  { 44532,  182 },
+  { 44804,  184 },
+  { 45067,  186 },
+  { 45320,  188 },
+  { 45565,  190 },
+  { 45800,  192 },
+  { 46027,  194 },
+  { 46246,  196 },
+  { 46458,  198 },
+  { 46661,  200 },
+  { 46858,  202 },
+  { 47047,  204 },
+  { 47230,  206 },
+  { 47406,  208 },
+  { 47576,  210 },
+  { 47740,  212 },
+  { 47897,  214 },
+  { 48050,  216 },
+  { 48197,  218 },
+  { 48338,  220 },
+  { 48475,  222 },
+  { 48607,  224 },
+  { 48734,  226 },
+  { 48857,  228 },
+  { 48975,  230 },
+  { 49090,  232 },
+  { 49200,  234 },
+  { 49306,  236 },
+  { 49409,  238 },
+  { 49509,  240 },
+  { 49604,  242 },
+  { 49697,  244 },
+  { 49786,  246 },
+  { 49873,  248 },
+  { 49956,  250 },
+  { 50037,  252 },
+  { 50115,  254 },
+  { 50190,  256 },
+  { 50263,  258 },
+  { 50334,  260 },
+  { 50402,  262 },
+  { 50468,  264 },
+  { 50531,  266 },
+  { 50593,  268 },
+  { 50653,  270 },
+  { 50710,  272 },
+  { 50766,  274 },
+  { 50820,  276 },
+  { 50873,  278 },
+  { 50923,  280 },
+  { 50973,  282 },
+  { 51020,  284 },
+  { 51066,  286 },
+  { 51111,  288 },
+  { 51154,  290 },
+  { 51196,  292 },
+  { 51237,  294 },
+  { 51276,  296 },
+  { 51314,  298 },
+  { 51351,  300 },
+};
@@ -59,6 +59,11 @@ typedef struct { raw_adc_t value; celsius_t celsius; } temp_entry_t;
   #undef OV
   #define OV(N) (N)
   #include "thermistor_133.h"
+  #undef OV
+  #define OV(N) raw_adc_t(OV_SCALE(N) * (OVERSAMPLENR) * (THERMISTOR_TABLE_SCALE))
+#endif
+#if ADS1115_BED_READING // Bed zones read by the ADS1115, in ADS1115 counts
+  #include "thermistor_ads1115.h"
 #endif
 #if ANY_THERMISTOR_IS(2) // 4338 K, R25 = 200 kOhm, Pull-up = 4.7 kOhm, "ATC Semitec 204GT-2"
   #include "thermistor_2.h"
@@ -281,7 +286,10 @@ typedef struct { raw_adc_t value; celsius_t celsius; } temp_entry_t;
   #define TEMPTABLE_7_LEN 0
 #endif
 
-#if TEMP_SENSOR_BED0 > 0
+#if ADS1115_BED_READING
+  #define TEMPTABLE_BED temptable_ads1115
+  #define TEMPTABLE_BED_LEN COUNT(TEMPTABLE_BED)
+#elif TEMP_SENSOR_BED0 > 0
   #define TEMPTABLE_BED TT_NAME(TEMP_SENSOR_BED0)
   #define TEMPTABLE_BED_LEN COUNT(TEMPTABLE_BED)
 #else
@@ -438,6 +438,160 @@ class FileTransferProtocol(object):
         return True
 
 
+class MotionProtocol(object):
+    """
+    G-code over the binary stream, for firmware with BINARY_MOTION_COMMANDS.
+    Motion and common M-codes are sent pre-tokenized, with decimal fixed-point
+    values. Other commands are sent as text. See feature/binary_motion.h.
+    """
+    protocol_id = 2
+
+    class Packet(object):
+        QUERY    = 0
+        COMMANDS = 1
+
+    # Parameter letters by mask bit, as BINARY_MOTION_PARAMS
+    PARAMS = "XYZEFIJRSPABCDGHKLMNOQTUVW"
+    # Commands sent pre-tokenized, as BinaryMotionProtocol::tokenized()
+    TOKENIZED = {
+        'G': {0, 1, 2, 3, 4, 5, 10, 11, 28, 90, 91, 92},
+        'M': {3, 4, 5, 17, 18, 82, 83, 84, 104, 106, 107, 109, 140, 190, 204, 205, 220, 221, 400},
+    }
+    MAX_DECIMALS = 7
+
+    responses = deque()
+    def __init__(self, protocol, timeout = None):
+        protocol.register(['PMC:version:', 'PMC:invalid'], self.process_input)
+        self.protocol = protocol
+        self.response_timeout = timeout or protocol.response_timeout
+        self.max_commands = 1
+        self.max_values = 0
+
+    def process_input(self, data):
+        #print(data)
+        self.responses.append(data)
+        # A refused packet gets no "ok", so stop sending it
+        if data[0] == 'PMC:invalid':
+            self.protocol.packet_status = -1
+
+    def await_response(self, timeout = None):
+        timeout = TimeOut(timeout or self.response_timeout)
+        while not len(self.responses):
+            time.sleep(0.0001)
+            if timeout.timedout():
+                raise ReadTimeout()
+
+        return self.responses.popleft()
+
+    def connect(self):
+        self.protocol.send(MotionProtocol.protocol_id, MotionProtocol.Packet.QUERY);
+
+        token, data = self.await_response()
+        if token != 'PMC:version:':
+            return False
+
+        self.version, _, commands, _, values = data.split(':')
+        self.max_commands = int(commands)
+        self.max_values = int(values)
+        print("Motion commands version: {0}, {1} commands per packet".format(self.version, self.max_commands))
+        return True
+
+    @staticmethod
+    def pack_varint(value):
+        out = bytearray()
+        while value >= 0x80:
+            out.append((value & 0x7F) | 0x80)
+            value >>= 7
+        out.append(value)
+        return out
+
+    def tokenize(self, line):
+        """Return the command pre-tokenized, or None if it must go as text"""
+        words = line.split()
+        if not words or len(words[0]) < 2 or not words[0][1:].isdigit():
+            return None
+        letter, codenum = words[0][0], int(words[0][1:])
+        if letter != 'T' and codenum not in MotionProtocol.TOKENIZED.get(letter, ()):
+            return None
+
+        values, flags = {}, 0
+        for word in words[1:]:
+            bit = MotionProtocol.PARAMS.find(word[0])
+            if bit < 0 or bit in values or flags & (1 << bit):
+                return None
+            if len(word) == 1:
+                flags |= 1 << bit
+                continue
+            number = word[1:]
+            negative = number[0] == '-'
+            if number[0] in '+-':
+                number = number[1:]
+            whole, _, fraction = number.partition('.')
+            digits = whole + fraction.rstrip('0')
+            if not digits.isdigit() or not (whole + fraction).isdigit():
+                return None
+            # A mantissa under 2^24 is an exact float, so the firmware rounds as strtof
+            mantissa, decimals = int(digits), len(fraction.rstrip('0'))
+            if mantissa >= 1 << 24 or decimals > MotionProtocol.MAX_DECIMALS:
+                return None
+            zigzag = mantissa * 2 - 1 if negative and mantissa else mantissa * 2
+            values[bit] = (zigzag << 3) | decimals
+
+        if len(values) > self.max_values:
+            return None
+
+        out = bytearray([ord(letter) | (0x80 if flags else 0)])
+        out += self.pack_varint(codenum)
+        out += self.pack_varint(sum(1 << bit for bit in values))
+        if flags:
+            out += self.pack_varint(flags)
+        for bit in sorted(values):
+            out += self.pack_varint(values[bit])
+        return out
+
+    def encode(self, line):
+        """A command for a COMMANDS packet, without the comment"""
+        line = line.split(';', 1)[0].strip()
+        if not line:
+            return None
+        return self.tokenize(line) or b'\0' + bytearray(line, 'utf8') + b'\0'
+
+    def packets(self, lines):
+        """Pack the commands into payloads for the command queue and the packet buffer"""
+        payload = bytearray(1)
+        for line in lines:
+            command = self.encode(line)
+            if command is None:
+                continue
+            if payload[0] == self.max_commands or len(payload) + len(command) > self.protocol.block_size:
+                yield payload
+                payload = bytearray(1)
+            payload += command
+            payload[0] += 1
+        if payload[0]:
+            yield payload
+
+    def send(self, lines):
+        for payload in self.packets(lines):
+            self.protocol.send(MotionProtocol.protocol_id, MotionProtocol.Packet.COMMANDS, payload)
+            if len(self.responses):
+                token, data = self.responses.popleft()
+                if token == 'PMC:invalid':
+                    raise FatalError()
+
+    def stream(self, filename):
+        """Send a G-code file. The firmware takes each packet once its commands fit in the queue."""
+        if not self.connect():
+            return False
+        start_time = millis()
+        with open(filename, "r") as f:
+            lines = f.readlines()
+        self.send(lines)
+        secs = (millis() - start_time) / 1000
+        print("{0} lines in {1:4.2f}s ({2:.0f} lines/s) Errors: {3}".format(len(lines), secs, len(lines) / secs if secs else 0, self.protocol.errors))
+        return True
+
+
 class EchoProtocol(object):
     def __init__(self, protocol):
         protocol.register(['echo:'], self.process_input)